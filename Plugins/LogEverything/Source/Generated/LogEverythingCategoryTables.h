@@ -0,0 +1,77 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// 由 Tools/GenerateCategoryTables.py 根据 LogEverythingLogger.h 生成，请勿手动修改
+// Generated by Tools/GenerateCategoryTables.py from LogEverythingLogger.h. Do not edit.
+
+#pragma once
+
+#include "Category/LECategoryTreeCore.h"
+
+namespace LogEverythingGenerated
+{
+	inline constexpr int32 CategoryCount = 18;
+
+	// ParentIndex, FirstChildIndex, LastChildIndex, NextSiblingIndex, SubtreeEnd, Depth, BqCategoryIndex
+	inline constexpr FLECategoryNodeLinks CategoryNodeLinks[CategoryCount] =
+	{
+		{ -1, 1, 16, -1, 18, 0, 0 }, // LogRoot
+		{ 0, -1, -1, 2, 2, 1, 1 }, // Engine
+		{ 0, 3, 11, 15, 15, 1, 2 }, // Game
+		{ 2, 4, 6, 7, 7, 2, 3 }, // Game.Combat
+		{ 3, -1, -1, 5, 5, 3, 4 }, // Game.Combat.Damage
+		{ 3, -1, -1, 6, 6, 3, 5 }, // Game.Combat.Skill
+		{ 3, -1, -1, -1, 7, 3, 6 }, // Game.Combat.Input
+		{ 2, -1, -1, 8, 8, 2, 7 }, // Game.Animation
+		{ 2, 9, 10, 11, 11, 2, 8 }, // Game.AI
+		{ 8, -1, -1, 10, 10, 3, 9 }, // Game.AI.BehaviorTree
+		{ 8, -1, -1, -1, 11, 3, 10 }, // Game.AI.Pathfinding
+		{ 2, 12, 14, -1, 15, 2, 11 }, // Game.Input
+		{ 11, -1, -1, 13, 13, 3, 12 }, // Game.Input.Ability
+		{ 11, -1, -1, 14, 14, 3, 13 }, // Game.Input.Movement
+		{ 11, -1, -1, -1, 15, 3, 14 }, // Game.Input.Interaction
+		{ 0, -1, -1, 16, 16, 1, 15 }, // Editor
+		{ 0, 17, 17, -1, 18, 1, 16 }, // Test
+		{ 16, -1, -1, -1, 18, 2, 17 }, // Test.LogSystem
+	};
+
+	inline constexpr const TCHAR* CategoryFullNames[CategoryCount] =
+	{
+		TEXT("LogRoot"),
+		TEXT("Engine"),
+		TEXT("Game"),
+		TEXT("Game.Combat"),
+		TEXT("Game.Combat.Damage"),
+		TEXT("Game.Combat.Skill"),
+		TEXT("Game.Combat.Input"),
+		TEXT("Game.Animation"),
+		TEXT("Game.AI"),
+		TEXT("Game.AI.BehaviorTree"),
+		TEXT("Game.AI.Pathfinding"),
+		TEXT("Game.Input"),
+		TEXT("Game.Input.Ability"),
+		TEXT("Game.Input.Movement"),
+		TEXT("Game.Input.Interaction"),
+		TEXT("Editor"),
+		TEXT("Test"),
+		TEXT("Test.LogSystem"),
+	};
+
+	inline constexpr int32 CategoryFullNameLengths[CategoryCount] =
+	{
+		7, 6, 4, 11, 18, 17, 17, 14, 7, 20, 19, 10, 18, 19, 22, 6, 4, 14
+	};
+
+	inline constexpr int32 CategorySubNameOffsets[CategoryCount] =
+	{
+		0, 0, 0, 5, 12, 12, 12, 5, 5, 8, 8, 5, 11, 11, 11, 0, 0, 5
+	};
+
+	inline constexpr FLECategoryTreeTables CategoryTreeTables =
+	{
+		CategoryCount,
+		CategoryNodeLinks,
+		CategoryFullNames,
+		CategoryFullNameLengths,
+		CategorySubNameOffsets
+	};
+}
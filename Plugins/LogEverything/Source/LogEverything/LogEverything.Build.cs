@@ -1,7 +1,11 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 using UnrealBuildTool;
+using System;
+using System.Collections.Generic;
+using System.Linq;
 using System.IO;
+using System.Text.RegularExpressions;
 
 public class LogEverything : ModuleRules
 {
@@ -78,6 +82,9 @@ public class LogEverything : ModuleRules
 		// 平台特定的编译定义
 		AddPlatformDefinitions(Target.Platform);
 
+		// 分类编译期最低级别的构建配置覆盖
+		AddCompiledVerbosityOverrides(Target);
+
 		// 模块依赖
 		PublicDependencyModuleNames.AddRange(new string[]
 		{
@@ -244,6 +251,170 @@ public class LogEverything : ModuleRules
 		}
 	}
 
+	/// <summary>
+	/// 解析 Config/LogEverythingCategories.txt 中的 //@CompiledMinVerbosity 指令，
+	/// 生成 LE_COMPILED_MIN_VERBOSITY_OVERRIDES 定义
+	///
+	/// 指令格式：//@CompiledMinVerbosity &lt;构建配置列表|*&gt; &lt;分类路径|*&gt; &lt;级别&gt;
+	/// 例如：//@CompiledMinVerbosity Shipping,Test Game.AI Warning
+	///
+	/// 分类索引取自生成的 LogEverythingLogger.h 中的 names[]（与 GenerateCategoryTables.py 相同），
+	/// 配置文件与生成结果不一致（修改后未重新生成）时构建失败；
+	/// 覆盖作用于该分类及其所有子分类，更具体的路径优先，不存在的分类路径输出警告
+	/// </summary>
+	private void AddCompiledVerbosityOverrides(ReadOnlyTargetRules Target)
+	{
+		string CategoriesFile = Path.Combine(ModuleDirectory, "..", "..", "Config", "LogEverythingCategories.txt");
+		if (!File.Exists(CategoriesFile))
+		{
+			return;
+		}
+
+		string GeneratedLoggerFile = Path.Combine(ModuleDirectory, "..", "..", "Source", "Generated", "LogEverythingLogger.h");
+
+		// 配置文件或生成结果变化时重新生成编译定义
+		ExternalDependencies.Add(CategoriesFile);
+		ExternalDependencies.Add(GeneratedLoggerFile);
+
+		Dictionary<string, int> LevelValues = new Dictionary<string, int>(StringComparer.OrdinalIgnoreCase)
+		{
+			{ "Verbose", 0 }, { "Debug", 1 }, { "Info", 2 }, { "Warning", 3 }, { "Error", 4 }, { "Fatal", 5 }, { "NoLogging", 255 }
+		};
+
+		// 分类树：路径 -> 子路径列表（保持插入顺序），根路径为空字符串
+		Dictionary<string, List<string>> Children = new Dictionary<string, List<string>>(StringComparer.Ordinal) { { "", new List<string>() } };
+		Dictionary<string, int> OverrideLevels = new Dictionary<string, int>(StringComparer.Ordinal);
+		string ConfigurationName = Target.Configuration.ToString();
+
+		foreach (string RawLine in File.ReadAllLines(CategoriesFile))
+		{
+			string Line = RawLine.Trim();
+			if (Line.StartsWith("//@CompiledMinVerbosity", StringComparison.Ordinal))
+			{
+				string[] Tokens = Line.Substring("//@CompiledMinVerbosity".Length).Split(new char[] { ' ', '\t' }, StringSplitOptions.RemoveEmptyEntries);
+				int Level;
+				if (Tokens.Length != 3 || !LevelValues.TryGetValue(Tokens[2], out Level))
+				{
+					System.Console.WriteLine($"Warning: LogEverything: invalid compiled verbosity directive: {Line}");
+					continue;
+				}
+
+				bool bMatchesConfiguration = Tokens[0] == "*" || Array.Exists(Tokens[0].Split(','),
+					Name => string.Equals(Name.Trim(), ConfigurationName, StringComparison.OrdinalIgnoreCase));
+				if (bMatchesConfiguration)
+				{
+					OverrideLevels[Tokens[1] == "*" ? "" : Tokens[1]] = Level;
+				}
+				continue;
+			}
+
+			// 去掉行尾注释后即为分类路径
+			int CommentIndex = Line.IndexOf("//", StringComparison.Ordinal);
+			string CategoryPath = (CommentIndex >= 0 ? Line.Substring(0, CommentIndex) : Line).Trim();
+			if (CategoryPath.Length == 0)
+			{
+				continue;
+			}
+
+			string ParentPath = "";
+			foreach (string Segment in CategoryPath.Split('.'))
+			{
+				string NodePath = ParentPath.Length == 0 ? Segment : ParentPath + "." + Segment;
+				if (!Children.ContainsKey(NodePath))
+				{
+					Children[NodePath] = new List<string>();
+					Children[ParentPath].Add(NodePath);
+				}
+				ParentPath = NodePath;
+			}
+		}
+
+		if (OverrideLevels.Count == 0)
+		{
+			return;
+		}
+
+		// BqLog 分类索引以生成的 names[] 为准，下标即 CAT_INDEX
+		List<string> CategoryNames = ReadGeneratedCategoryNames(GeneratedLoggerFile);
+
+		// 配置文件按先序展开后必须与生成结果一致，否则索引会错位
+		List<string> ConfiguredNames = new List<string>();
+		void Visit(string NodePath)
+		{
+			ConfiguredNames.Add(NodePath);
+			foreach (string ChildPath in Children[NodePath])
+			{
+				Visit(ChildPath);
+			}
+		}
+		Visit("");
+
+		if (!ConfiguredNames.SequenceEqual(CategoryNames))
+		{
+			throw new BuildException($"LogEverything: {CategoriesFile} does not match {GeneratedLoggerFile}; run GenerateLogEverythingCategories.bat to regenerate the category headers");
+		}
+
+		HashSet<string> KnownNames = new HashSet<string>(CategoryNames, StringComparer.Ordinal);
+		foreach (string OverridePath in OverrideLevels.Keys)
+		{
+			if (!KnownNames.Contains(OverridePath))
+			{
+				System.Console.WriteLine($"Warning: LogEverything: compiled verbosity directive names unknown category '{OverridePath}'");
+			}
+		}
+
+		// 每个分类取最近的带覆盖的祖先（含自身）
+		List<string> Entries = new List<string>();
+		for (int Index = 0; Index < CategoryNames.Count; ++Index)
+		{
+			string NodePath = CategoryNames[Index];
+			int Level;
+			while (!OverrideLevels.TryGetValue(NodePath, out Level) && NodePath.Length > 0)
+			{
+				int DotIndex = NodePath.LastIndexOf('.');
+				NodePath = DotIndex >= 0 ? NodePath.Substring(0, DotIndex) : "";
+			}
+			if (!OverrideLevels.ContainsKey(NodePath))
+			{
+				continue;
+			}
+
+			Entries.Add(((Index << 8) | Level).ToString());
+		}
+
+		PublicDefinitions.Add("LE_COMPILED_MIN_VERBOSITY_OVERRIDES=" + string.Join(",", Entries));
+		System.Console.WriteLine($"LogEverything: {Entries.Count} compiled verbosity overrides for {ConfigurationName}");
+	}
+
+	/// <summary>
+	/// 读取 BqLog 分类生成器输出的 names[] 数组（下标即 BqLog 分类索引，0 为根分类 ""）
+	/// </summary>
+	private static List<string> ReadGeneratedCategoryNames(string GeneratedLoggerFile)
+	{
+		if (!File.Exists(GeneratedLoggerFile))
+		{
+			throw new BuildException($"LogEverything: {GeneratedLoggerFile} not found; run GenerateLogEverythingCategories.bat to generate the category headers");
+		}
+
+		Match NamesMatch = Regex.Match(File.ReadAllText(GeneratedLoggerFile), @"const\s+char\s*\*\s*names\s*\[\s*(\d+)\s*\]\s*=\s*\{(.*?)\};", RegexOptions.Singleline);
+		if (!NamesMatch.Success)
+		{
+			throw new BuildException($"LogEverything: no category names array found in {GeneratedLoggerFile}");
+		}
+
+		List<string> Names = new List<string>();
+		foreach (Match NameMatch in Regex.Matches(NamesMatch.Groups[2].Value, "\"((?:[^\"\\\\]|\\\\.)*)\""))
+		{
+			Names.Add(NameMatch.Groups[1].Value);
+		}
+
+		if (Names.Count != int.Parse(NamesMatch.Groups[1].Value) || Names.Count == 0 || Names[0].Length != 0)
+		{
+			throw new BuildException($"LogEverything: malformed category names array in {GeneratedLoggerFile}");
+		}
+		return Names;
+	}
+
 	private void AddPlatformDefinitions(UnrealTargetPlatform Platform)
 	{
 		if (Platform == UnrealTargetPlatform.Win64)
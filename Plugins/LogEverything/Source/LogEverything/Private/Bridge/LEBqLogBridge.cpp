@@ -1,22 +1,288 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Bridge/LEBqLogBridge.h"
+#include "Bridge/LEBqLogConfig.h"
+#include "Category/LECategoryRules.h"
 #include "Utils/LogEverythingUtils.h"
+#include "System/LELogCallSite.h"
+#include "Generated/LogEverythingCategoryTables.h"
 #include "HAL/PlatformFilemanager.h"
 #include "HAL/PlatformProcess.h"
 #include "Misc/Paths.h"
-#include "Misc/DateTime.h"
 
 // BqLog 包含文件
 #include "bq_log/bq_log.h"
 
-// 静态成员初始化
-FLEBqLogBridge* FLEBqLogBridge::Instance = nullptr;
+namespace LogEverything
+{
+	namespace Private
+	{
+		/** BqLog 配置中的级别名称（下标与 ELELogVerbosity 一致） */
+		static const TCHAR* const BqLogLevelNames[] =
+		{
+			TEXT("verbose"), TEXT("debug"), TEXT("info"), TEXT("warning"), TEXT("error"), TEXT("fatal")
+		};
+
+		static const TCHAR* const AllLevelsConfig = TEXT("[all]");
+		static const TCHAR* const AllCategoriesMaskConfig = TEXT("all");
+
+		/** 构建从 LowestLevel 到 fatal 的级别列表 */
+		static FString BuildLevelsConfig(uint8 LowestLevel)
+		{
+			if (LowestLevel == 0)
+			{
+				return AllLevelsConfig;
+			}
+
+			FString LevelsConfig = TEXT("[");
+			for (uint8 Level = LowestLevel; Level <= static_cast<uint8>(ELELogVerbosity::Fatal); ++Level)
+			{
+				if (Level != LowestLevel)
+				{
+					LevelsConfig += TEXT(",");
+				}
+				LevelsConfig += BqLogLevelNames[Level];
+			}
+			LevelsConfig += TEXT("]");
+			return LevelsConfig;
+		}
+
+		/**
+		 * 将过滤字节表编译为 BqLog 级别列表与分类掩码
+		 * @param GetCategoryName 按 BqLog 分类索引返回分类名
+		 * @return BqLog 的单次内联检查能否精确表达该过滤表
+		 */
+		static bool CompileNativeFilter(const FLENativeCategoryFilter& Filter, int32 NumCategories, TFunctionRef<FString(int32)> GetCategoryName,
+			FString& OutLevelsConfig, FString& OutCategoriesMaskConfig)
+		{
+			const uint8 MaxLevel = static_cast<uint8>(ELELogVerbosity::Fatal);
+
+			uint8 LowestThreshold = static_cast<uint8>(ELELogVerbosity::NoLogging);
+			uint8 HighestThreshold = 0;
+			bool bAllEnabled = true;
+			bool bMaskExact = true;
+			TArray<FString> MaskEntries;
+			MaskEntries.Reserve(NumCategories);
+
+			for (int32 BqIndex = 0; BqIndex < NumCategories; ++BqIndex)
+			{
+				const uint8 Threshold = Filter.FilterBytes[BqIndex];
+				if (Threshold > MaxLevel)
+				{
+					bAllEnabled = false;
+
+					// BqLog 的分类掩码按前缀匹配子分类，已启用的祖先会把被禁用的子分类一并放行
+					for (int32 ParentIndex = Filter.ParentIndices.IsValidIndex(BqIndex) ? Filter.ParentIndices[BqIndex] : INDEX_NONE;
+						ParentIndex > 0 && ParentIndex < NumCategories;
+						ParentIndex = Filter.ParentIndices[ParentIndex])
+					{
+						if (Filter.FilterBytes[ParentIndex] <= MaxLevel)
+						{
+							bMaskExact = false;
+							break;
+						}
+					}
+					continue;
+				}
+
+				LowestThreshold = FMath::Min(LowestThreshold, Threshold);
+				HighestThreshold = FMath::Max(HighestThreshold, Threshold);
+				MaskEntries.Add(BqIndex == 0 ? FString(TEXT("*default")) : GetCategoryName(BqIndex));
+			}
+
+			// 所有分类都被禁用时仍需合法配置：只保留 fatal，由掩码拦截
+			if (LowestThreshold > MaxLevel)
+			{
+				LowestThreshold = MaxLevel;
+				HighestThreshold = MaxLevel;
+			}
+
+			OutLevelsConfig = BuildLevelsConfig(LowestThreshold);
+			OutCategoriesMaskConfig = bAllEnabled
+				? FString(AllCategoriesMaskConfig)
+				: FString::Printf(TEXT("[%s]"), *FString::Join(MaskEntries, TEXT(",")));
+
+			// 只有当启用分类共享同一阈值且掩码不依赖前缀歧义时，BqLog 的单次内联检查才是精确的
+			return bMaskExact && LowestThreshold == HighestThreshold;
+		}
+
+		/**
+		 * 由 FLELogSettings::CategoryLevels 与全局级别构建初始过滤表（分类树尚未发布前使用）
+		 * 未配置的分类继承最近的已配置祖先，根分类默认使用全局级别
+		 */
+		static FLENativeCategoryFilter BuildInitialNativeFilter(const FLELogSettings& Settings)
+		{
+			TMap<FName, ELELogVerbosity> ConfiguredLevels;
+			for (const FLECategoryLevel& CategoryLevel : Settings.CategoryLevels)
+			{
+				FString CategoryName = CategoryLevel.CategoryName.ToString();
+				CategoryName.RemoveFromStart(TEXT("LogRoot."));
+				ConfiguredLevels.Add(FName(*CategoryName), CategoryLevel.LogLevel);
+			}
+
+			FLENativeCategoryFilter Filter;
+			Filter.FilterBytes.SetNumUninitialized(LogEverythingGenerated::CategoryCount);
+			Filter.ParentIndices.SetNumUninitialized(LogEverythingGenerated::CategoryCount);
+			for (int32 BqIndex = 0; BqIndex < LogEverythingGenerated::CategoryCount; ++BqIndex)
+			{
+				// 生成表按前序排列，父分类总是先于子分类处理
+				const int32 ParentIndex = LogEverythingGenerated::CategoryNodeLinks[BqIndex].ParentIndex;
+				const ELELogVerbosity* ConfiguredLevel = ConfiguredLevels.Find(FName(LogEverythingGenerated::CategoryFullNames[BqIndex]));
+				Filter.ParentIndices[BqIndex] = ParentIndex;
+				Filter.FilterBytes[BqIndex] = ConfiguredLevel ? static_cast<uint8>(*ConfiguredLevel)
+					: ParentIndex != INDEX_NONE ? Filter.FilterBytes[ParentIndex]
+					: static_cast<uint8>(Settings.GlobalLogLevel);
+			}
+			return Filter;
+		}
+
+		/**
+		 * 解析日志文件路径：相对路径基于 Saved 目录，去掉扩展名（由 BqLog 按 appender 类型追加），
+		 * 并追加进程 ID 避免多进程写同一文件
+		 */
+		static FString ResolveLogFileBasePath(const FString& LogFilePath)
+		{
+			FString BasePath = LogFilePath.IsEmpty() ? FString(TEXT("LogEverything/LE")) : LogFilePath;
+			if (FPaths::IsRelative(BasePath))
+			{
+				BasePath = FPaths::Combine(FPaths::ProjectSavedDir(), BasePath);
+			}
+			BasePath = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::GetPath(BasePath), FPaths::GetBaseFilename(BasePath)));
+			BasePath += FString::Printf(TEXT("_%u"), FPlatformProcess::GetCurrentProcessId());
+
+			// BqLog 使用正斜杠路径
+			return BasePath.Replace(TEXT("\\"), TEXT("/"));
+		}
+
+		/** 高可靠 logger 的文件后缀，与主日志文件并列 */
+		static const TCHAR* const ReliableFileSuffix = TEXT("_reliable");
+
+		/**
+		 * 由主 logger 的基础配置派生高可靠 logger 的配置
+		 * 只保留文件类 appender（文件名追加后缀），没有文件输出时回退到一个文本文件；
+		 * 级别只包含 Guaranteed 的级别，分类过滤已在主 logger 上完成
+		 */
+		static FLEBqLogConfig BuildReliableConfig(const FLEBqLogConfig& BaseConfig, const FString& FileBasePath, const FLELogReliabilityPolicy& Policy)
+		{
+			FLEBqLogConfig Config;
+			Config.ThreadMode = BaseConfig.ThreadMode;
+			Config.BufferSize = BaseConfig.BufferSize;
+			Config.ReliableLevel = TEXT("high");
+			Config.CategoriesMask = AllCategoriesMaskConfig;
+
+			for (const FLEBqLogAppenderConfig& Appender : BaseConfig.Appenders)
+			{
+				if (Appender.IsFileAppender())
+				{
+					FLEBqLogAppenderConfig& ReliableAppender = Config.Appenders.Add_GetRef(Appender);
+					ReliableAppender.FileName += ReliableFileSuffix;
+				}
+			}
+			if (Config.Appenders.IsEmpty())
+			{
+				FLEBqLogAppenderConfig& Appender = Config.Appenders.AddDefaulted_GetRef();
+				Appender.Name = TEXT("appender_0");
+				Appender.Type = TEXT("text_file");
+				Appender.FileName = FileBasePath + ReliableFileSuffix;
+			}
+
+			TArray<FString> GuaranteedLevels;
+			for (uint8 Level = 0; Level <= static_cast<uint8>(ELELogVerbosity::Fatal); ++Level)
+			{
+				if (Policy.GetForLevel(static_cast<ELELogVerbosity>(Level)) == ELELogReliability::Guaranteed)
+				{
+					GuaranteedLevels.Add(BqLogLevelNames[Level]);
+				}
+			}
+			Config.SetLevels(FString::Printf(TEXT("[%s]"), *FString::Join(GuaranteedLevels, TEXT(","))));
+			return Config;
+		}
+
+		/** 由主 logger 的基础配置派生路由 logger 的配置：同样的 appender（文件名追加 _<路由名>），独立线程与自己的缓冲区 */
+		static FLEBqLogConfig BuildRouteConfig(const FLEBqLogConfig& BaseConfig, const FLELogRoute& Route)
+		{
+			FLEBqLogConfig Config = BaseConfig;
+			Config.ThreadMode = TEXT("independent");
+			Config.BufferSize = Route.BufferSize;
+			for (FLEBqLogAppenderConfig& Appender : Config.Appenders)
+			{
+				if (Appender.IsFileAppender())
+				{
+					Appender.FileName += FString::Printf(TEXT("_%s"), *Route.Name.ToString());
+				}
+			}
+			return Config;
+		}
+
+		/** 路由的分类匹配器，模式无效时返回 false */
+		static bool ParseRouteMatchers(const FLELogRoute& Route, TArray<FLECategoryRule>& OutMatchers)
+		{
+			for (const FString& Pattern : Route.Categories)
+			{
+				// 借用分类规则的模式语法，禁用形式的规则只携带模式
+				FLECategoryRule Matcher;
+				if (!FLECategoryRule::Parse(FString::Printf(TEXT("!%s"), *Pattern), Matcher))
+				{
+					return false;
+				}
+				OutMatchers.Add(MoveTemp(Matcher));
+			}
+			return true;
+		}
+
+		/** 已校验的路由及其匹配器 */
+		struct FResolvedRoute
+		{
+			int32 RouteIndex = INDEX_NONE;
+			TArray<FLECategoryRule> Matchers;
+			uint8 MinLevel = 0;
+			uint8 MaxLevel = 0;
+
+			bool Matches(int32 BqCategoryIndex, uint8 Level) const
+			{
+				if (Level < MinLevel || Level > MaxLevel)
+				{
+					return false;
+				}
+				if (Matchers.IsEmpty())
+				{
+					return true;
+				}
+
+				const FStringView CategoryPath = LogEverythingGenerated::CategoryFullNames[BqCategoryIndex];
+				return Matchers.ContainsByPredicate([CategoryPath](const FLECategoryRule& Matcher) { return Matcher.Matches(CategoryPath); });
+			}
+		};
+	}
+}
 
 FLEBqLogBridge::FLEBqLogBridge()
-	: CategoryLogInstance(nullptr)
+	: BlockTimeoutCycles(0)
+	, NextDropSummaryCycles(0)
 	, bIsInitialized(false)
+	, bNativeFiltering(false)
+	, bNativeFilterExact(true)
+	, bNativeFilterCompiledExact(true)
+	, bNativeFilterRelaxed(false)
+	, NativeFilterSnapshot(nullptr)
+	, NativeLevelsConfig(LogEverything::Private::AllLevelsConfig)
+	, NativeCategoriesMaskConfig(LogEverything::Private::AllCategoriesMaskConfig)
 {
+	MainLogger.BaseName = TEXT("LogEverythingLogger");
+	ReliableLogger.BaseName = TEXT("LogEverythingReliableLogger");
+	for (int32 RouteSlot = 0; RouteSlot < MaxRoutes; ++RouteSlot)
+	{
+		RouteLoggers[RouteSlot].BaseName = FString::Printf(TEXT("LogEverythingRouteLogger%d"), RouteSlot + 1);
+	}
+	for (std::atomic<uint8>& Route : RouteTable)
+	{
+		Route.store(0, std::memory_order_relaxed);
+	}
+	for (int32& RouteIndex : RouteSlotToIndex)
+	{
+		RouteIndex = INDEX_NONE;
+	}
+	PublishReliabilityPolicy(CurrentSettings.ReliabilityPolicy);
 }
 
 FLEBqLogBridge::~FLEBqLogBridge()
@@ -26,31 +292,41 @@ FLEBqLogBridge::~FLEBqLogBridge()
 
 FLEBqLogBridge& FLEBqLogBridge::Get()
 {
-	if (!Instance)
-	{
-		Instance = new FLEBqLogBridge();
-	}
-	return *Instance;
+	// 函数内静态变量的初始化是线程安全的，任意线程首次调用都不会重复创建
+	static FLEBqLogBridge* const SharedInstance = new FLEBqLogBridge();
+	return *SharedInstance;
 }
 
 const bq::LogEverythingLogger* FLEBqLogBridge::GetCategoryLogInstance() const
 {
-	if (!bIsInitialized || !CategoryLogInstance)
+	const bq::LogEverythingLogger* Logger = MainLogger.Instance.load(std::memory_order_acquire);
+	if (!bIsInitialized || !Logger)
 	{
 		LE_SYSTEM_ERROR(TEXT("BqLogBridge not initialized or CategoryLogInstance is null"));
 		return nullptr;
 	}
 
-	return CategoryLogInstance;
+	return Logger;
 }
 
 
 
 void FLEBqLogBridge::FlushLogs()
 {
-	if (bIsInitialized && CategoryLogInstance)
+	if (bq::LogEverythingLogger* Logger = MainLogger.Instance.load(std::memory_order_acquire))
+	{
+		Logger->force_flush();
+	}
+	if (bq::LogEverythingLogger* Logger = ReliableLogger.Instance.load(std::memory_order_acquire))
+	{
+		Logger->force_flush();
+	}
+	for (FLoggerSlot& Slot : RouteLoggers)
 	{
-		CategoryLogInstance->force_flush();
+		if (bq::LogEverythingLogger* Logger = Slot.Instance.load(std::memory_order_acquire))
+		{
+			Logger->force_flush();
+		}
 	}
 }
 
@@ -67,9 +343,31 @@ bool FLEBqLogBridge::Initialize(const FLELogSettings& Settings, ULELogSubsystem*
 	LogSystemPtr = InLogSystem;
 	// 保存配置
 	CurrentSettings = Settings;
+	PublishReliabilityPolicy(Settings.ReliabilityPolicy);
+
+	// 原生过滤模式在分类树发布前先使用配置中的分类级别编译出的初始掩码
+	bNativeFiltering = Settings.FilterMode == ELEFilterMode::NativeBqLog;
+	bNativeFilterExact = true;
+	PublishNativeFilterSnapshot(nullptr);
+	NativeLevelsConfig = LogEverything::Private::AllLevelsConfig;
+	NativeCategoriesMaskConfig = LogEverything::Private::AllCategoriesMaskConfig;
+	if (bNativeFiltering)
+	{
+		const FLENativeCategoryFilter InitialFilter = LogEverything::Private::BuildInitialNativeFilter(Settings);
+		const bool bExact = LogEverything::Private::CompileNativeFilter(InitialFilter, InitialFilter.FilterBytes.Num(),
+			[](int32 BqIndex) { return FString(LogEverythingGenerated::CategoryFullNames[BqIndex]); },
+			NativeLevelsConfig, NativeCategoriesMaskConfig);
+
+		FLECategoryFilterSnapshot* InitialSnapshot = new FLECategoryFilterSnapshot();
+		InitialSnapshot->FilterBytes = InitialFilter.FilterBytes;
+		PublishNativeFilterSnapshot(InitialSnapshot);
+		bNativeFilterCompiledExact = bExact;
+		bNativeFilterExact = bExact && !bNativeFilterRelaxed;
+	}
 
 	// 初始化 BqLog 实例
 	bIsInitialized = SetupBqLogConfig(Settings);
+	LogEverything::InvalidateCallSites();
 
 	if (bIsInitialized)
 	{
@@ -92,19 +390,136 @@ void FLEBqLogBridge::Shutdown()
 		return;
 	}
 
-	// BqLog 实例会在静态对象析构时自动清理
-	// 这里只需要重置指针
-	if (CategoryLogInstance)
+	// BqLog 不支持销毁 logger：刷新后停止发射，句柄保留给下一次 Initialize 复用
+	for (std::atomic<uint8>& Route : RouteTable)
+	{
+		Route.store(0, std::memory_order_relaxed);
+	}
+	for (FLoggerSlot* Slot : { &MainLogger, &ReliableLogger })
 	{
-		CategoryLogInstance->force_flush();
-		CategoryLogInstance = nullptr;
+		if (bq::LogEverythingLogger* Logger = Slot->Instance.exchange(nullptr, std::memory_order_acq_rel))
+		{
+			Logger->force_flush();
+		}
+	}
+	for (FLoggerSlot& Slot : RouteLoggers)
+	{
+		if (bq::LogEverythingLogger* Logger = Slot.Instance.exchange(nullptr, std::memory_order_acq_rel))
+		{
+			Logger->force_flush();
+		}
 	}
 
 	bIsInitialized = false;
+	bNativeFiltering = false;
+	bNativeFilterExact = true;
+	PublishNativeFilterSnapshot(nullptr);
+	LogEverything::InvalidateCallSites();
 
 	LE_SYSTEM_LOG(TEXT("FLEBqLogBridge shutdown"));
 }
 
+void FLEBqLogBridge::SetFilterMode(ELEFilterMode InFilterMode)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	const bool bNewNativeFiltering = InFilterMode == ELEFilterMode::NativeBqLog;
+	if (bNewNativeFiltering == bNativeFiltering)
+	{
+		return;
+	}
+
+	CurrentSettings.FilterMode = InFilterMode;
+	bNativeFiltering = bNewNativeFiltering;
+	bNativeFilterExact = true;
+	PublishNativeFilterSnapshot(nullptr);
+
+	if (!bNativeFiltering)
+	{
+		// 回到分类树过滤：BqLog 不再做任何过滤
+		NativeLevelsConfig = LogEverything::Private::AllLevelsConfig;
+		NativeCategoriesMaskConfig = LogEverything::Private::AllCategoriesMaskConfig;
+		if (bIsInitialized)
+		{
+			ResetBqLogConfig();
+		}
+	}
+
+	LogEverything::InvalidateCallSites();
+	LE_SYSTEM_LOG(TEXT("Filter mode set to: %s"), *UEnum::GetValueAsString(InFilterMode));
+}
+
+void FLEBqLogBridge::ApplyNativeCategoryFilter(const FLENativeCategoryFilter& Filter)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	const bq::LogEverythingLogger* Logger = MainLogger.Instance.load(std::memory_order_acquire);
+	if (!bIsInitialized || !Logger || !bNativeFiltering)
+	{
+		return;
+	}
+
+	const bq::array<bq::string>& CategoryNames = Logger->get_categories_name_array();
+	const int32 NumCategories = FMath::Min(Filter.FilterBytes.Num(), static_cast<int32>(CategoryNames.size()));
+
+	FString NewLevelsConfig;
+	FString NewCategoriesMaskConfig;
+	const bool bExact = LogEverything::Private::CompileNativeFilter(Filter, NumCategories,
+		[&CategoryNames](int32 BqIndex) { return UTF8ToFString(CategoryNames[BqIndex].c_str()); },
+		NewLevelsConfig, NewCategoriesMaskConfig);
+
+	// 先发布新的字节表，再切换精确标志，读者任何时刻看到的组合都是自洽的
+	FLECategoryFilterSnapshot* NewSnapshot = new FLECategoryFilterSnapshot();
+	NewSnapshot->FilterBytes.SetNumUninitialized(Filter.FilterBytes.Num());
+	FMemory::Memcpy(NewSnapshot->FilterBytes.GetData(), Filter.FilterBytes.GetData(), Filter.FilterBytes.Num());
+	PublishNativeFilterSnapshot(NewSnapshot);
+	bNativeFilterCompiledExact = bExact;
+	bNativeFilterExact = bExact && !bNativeFilterRelaxed;
+	LogEverything::InvalidateCallSites();
+
+	// 配置未变化时不触发 reset_config
+	if (NewLevelsConfig == NativeLevelsConfig && NewCategoriesMaskConfig == NativeCategoriesMaskConfig)
+	{
+		return;
+	}
+
+	NativeLevelsConfig = NewLevelsConfig;
+	NativeCategoriesMaskConfig = NewCategoriesMaskConfig;
+	ResetBqLogConfig();
+}
+
+void FLEBqLogBridge::SetNativeFilterRelaxed(bool bRelaxed)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	if (bRelaxed == bNativeFilterRelaxed)
+	{
+		return;
+	}
+	bNativeFilterRelaxed = bRelaxed;
+	if (!bIsInitialized || !bNativeFiltering)
+	{
+		return;
+	}
+
+	// 切换顺序保证任意时刻至少有一层按分类阈值过滤：
+	// 放宽时先让调用点改查字节表，再打开 BqLog；恢复时先收紧 BqLog，再交回给 BqLog 的内联检查
+	if (bRelaxed)
+	{
+		bNativeFilterExact = false;
+		LogEverything::InvalidateCallSites();
+		ResetBqLogConfig();
+	}
+	else
+	{
+		ResetBqLogConfig();
+		bNativeFilterExact = bNativeFilterCompiledExact.load(std::memory_order_relaxed);
+		LogEverything::InvalidateCallSites();
+	}
+
+	LE_SYSTEM_LOG(TEXT("Native BqLog filter %s"), bRelaxed ? TEXT("relaxed for watched objects") : TEXT("restored"));
+}
+
 FString FLEBqLogBridge::UTF8ToFString(const char* UTF8String)
 {
 	if (!UTF8String)
@@ -143,79 +558,399 @@ TArray<uint8> FLEBqLogBridge::FStringToUTF8(const FString& InString)
 
 bool FLEBqLogBridge::SetupBqLogConfig(const FLELogSettings& Settings)
 {
-	// 创建日志目录路径（使用 Saved/LogEverything 目录）
-	FString SavedDir = FPaths::ProjectSavedDir();
-	FString LogDirectory = FPaths::Combine(SavedDir, TEXT("LogEverything"));
+	// 文件名不含扩展名，BqLog 会按 appender 类型自动添加扩展名和时间戳
+	const FString NewLogPath = LogEverything::Private::ResolveLogFileBasePath(Settings.LogFilePath);
 
 	// 确保日志目录存在
+	const FString LogDirectory = FPaths::GetPath(NewLogPath);
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 	if (!PlatformFile.DirectoryExists(*LogDirectory))
 	{
 		PlatformFile.CreateDirectoryTree(*LogDirectory);
 	}
 
-	// 生成带时间戳的日志文件名（格式：LE_[进程ID]，不带扩展名）
-	// BqLog会自动添加扩展名和时间戳
-	FDateTime Now = FDateTime::Now();
-	uint32 ProcessId = FPlatformProcess::GetCurrentProcessId();
-	FString LogFileName = FString::Printf(TEXT("LE_%u"), ProcessId);
-
-	// 使用绝对路径（BqLog 使用）
-	FString AbsoluteLogPath = FPaths::Combine(LogDirectory, LogFileName);
-	// 将路径转换为正斜杠格式，BqLog 可能需要这种格式
-	AbsoluteLogPath = AbsoluteLogPath.Replace(TEXT("\\"), TEXT("/"));
-
-	LE_SYSTEM_LOG(TEXT("Setting up BqLog config:"));
-	LE_SYSTEM_LOG(TEXT("  LogDirectory: %s"), *LogDirectory);
-	LE_SYSTEM_LOG(TEXT("  LogFileName: %s"), *LogFileName);
-	LE_SYSTEM_LOG(TEXT("  AbsoluteLogPath: %s"), *AbsoluteLogPath);
-	LE_SYSTEM_LOG(TEXT("  BufferSize: %d"), Settings.BufferSize);
-	LE_SYSTEM_LOG(TEXT("  AsyncLogging: %s"), Settings.bEnableAsyncLogging ? TEXT("true") : TEXT("false"));
-	LE_SYSTEM_LOG(TEXT("  Compression: %s"), Settings.bEnableCompression ? TEXT("true") : TEXT("false"));
-
-	// 构建 BqLog 配置字符串（简化版本）
-	// 先尝试最简单的配置，避免复杂参数导致解析失败
-	FString ConfigString = FString::Printf(TEXT(
-		"appenders_config.appender_0.type=text_file\n"
-		"appenders_config.appender_0.file_name=%s\n"
-		"appenders_config.appender_0.levels=[all]\n"
-		"log.categories_mask=all"
-	),
-		*AbsoluteLogPath
-	);
+	// 新配置先在局部变量中构建与校验，失败时成员保持不变，之后的 reset_config 仍使用当前生效的配置
+	FLEBqLogConfig NewBaseConfig = FLEBqLogConfig::FromSettings(Settings, NewLogPath);
+	// 主 logger 缓冲区写满时不阻塞，是否等待由桥接层按级别策略决定
+	NewBaseConfig.ReliableLevel = TEXT("low");
+
+	// 构建 BqLog 配置字符串
+	const FString ConfigString = ApplyNativeFilterConfig(NewBaseConfig).ToString();
+
+	TArray<FString> ConfigErrors;
+	FLEBqLogConfig FinalConfig;
+	if (!FLEBqLogConfig::Parse(ConfigString, FinalConfig) || !FinalConfig.Validate(&ConfigErrors))
+	{
+		LE_SYSTEM_ERROR(TEXT("Invalid BqLog config: %s"), *FString::Join(ConfigErrors, TEXT("; ")));
+		LE_SYSTEM_ERROR(TEXT("%s"), *ConfigString);
+		return false;
+	}
 
 	// 输出配置字符串用于调试
 	LE_SYSTEM_LOG(TEXT("BqLog Config String:"));
 	LE_SYSTEM_LOG(TEXT("%s"), *ConfigString);
 
-	// 转换配置字符串为 UTF-8
-	TArray<uint8> ConfigUTF8 = FStringToUTF8(ConfigString);
-	// 确保有null终止符
-	if (ConfigUTF8.Num() == 0 || ConfigUTF8.Last() != 0)
+	if (!CreateOrUpdateLogger(MainLogger, FinalConfig))
+	{
+		return false;
+	}
+
+	AbsoluteLogPath = NewLogPath;
+	BaseConfig = MoveTemp(NewBaseConfig);
+
+	// 高可靠 logger 与路由 logger 失败不影响主 logger：Guaranteed 级别退化为 Block，路由的日志留在主 logger
+	UpdateReliableLogger();
+	UpdateRouteLoggers();
+	return true;
+}
+
+bool FLEBqLogBridge::UpdateRouteLoggers()
+{
+	using LogEverything::Private::FResolvedRoute;
+
+	const TArray<FLELogRoute>& Routes = CurrentSettings.Routes;
+	bool bAllApplied = true;
+
+	// 先创建或更新各路由的 logger，再发布查找表，发射路径看到新路由时目标已经就绪
+	TArray<FResolvedRoute> ResolvedRoutes;
+	TSet<FName> RouteNames;
+	for (int32 RouteIndex = 0; RouteIndex < Routes.Num(); ++RouteIndex)
+	{
+		const FLELogRoute& Route = Routes[RouteIndex];
+		const int32 RouteSlot = ResolvedRoutes.Num();
+		if (RouteSlot >= MaxRoutes)
+		{
+			LE_SYSTEM_WARNING(TEXT("Route %s ignored: at most %d routes are supported"), *Route.Name.ToString(), MaxRoutes);
+			bAllApplied = false;
+			continue;
+		}
+
+		FResolvedRoute Resolved;
+		Resolved.RouteIndex = RouteIndex;
+		Resolved.MinLevel = static_cast<uint8>(Route.MinLevel);
+		Resolved.MaxLevel = FMath::Min(static_cast<uint8>(Route.MaxLevel), static_cast<uint8>(ELELogVerbosity::Fatal));
+
+		bool bDuplicateName = false;
+		RouteNames.Add(Route.Name, &bDuplicateName);
+		if (Route.Name.IsNone() || bDuplicateName || Resolved.MinLevel > Resolved.MaxLevel
+			|| !LogEverything::Private::ParseRouteMatchers(Route, Resolved.Matchers))
+		{
+			LE_SYSTEM_WARNING(TEXT("Route %s ignored: needs a unique name, valid category patterns and MinLevel <= MaxLevel"), *Route.Name.ToString());
+			bAllApplied = false;
+			continue;
+		}
+
+		RouteBaseConfigs[RouteSlot] = LogEverything::Private::BuildRouteConfig(BaseConfig, Route);
+		const FLEBqLogConfig RouteConfig = ApplyNativeFilterConfig(RouteBaseConfigs[RouteSlot]);
+		TArray<FString> ConfigErrors;
+		if (!RouteConfig.Validate(&ConfigErrors))
+		{
+			LE_SYSTEM_WARNING(TEXT("Route %s ignored: %s"), *Route.Name.ToString(), *FString::Join(ConfigErrors, TEXT("; ")));
+			bAllApplied = false;
+			continue;
+		}
+		if (!CreateOrUpdateLogger(RouteLoggers[RouteSlot], RouteConfig))
+		{
+			LE_SYSTEM_WARNING(TEXT("Route %s ignored: failed to create its logger"), *Route.Name.ToString());
+			bAllApplied = false;
+			continue;
+		}
+
+		ResolvedRoutes.Add(MoveTemp(Resolved));
+	}
+
+	for (int32 RouteSlot = 0; RouteSlot < MaxRoutes; ++RouteSlot)
+	{
+		RouteSlotToIndex[RouteSlot] = ResolvedRoutes.IsValidIndex(RouteSlot) ? ResolvedRoutes[RouteSlot].RouteIndex : INDEX_NONE;
+	}
+
+	// 按分类与级别解析一次，第一条匹配的路由生效
+	for (int32 BqIndex = 0; BqIndex < LogEverythingGenerated::CategoryCount; ++BqIndex)
+	{
+		for (uint8 Level = 0; Level < NumLevels; ++Level)
+		{
+			const int32 RouteSlot = ResolvedRoutes.IndexOfByPredicate([BqIndex, Level](const FResolvedRoute& Resolved) { return Resolved.Matches(BqIndex, Level); });
+			RouteTable[BqIndex * NumLevels + Level].store(static_cast<uint8>(RouteSlot + 1), std::memory_order_relaxed);
+		}
+	}
+
+	// 查找表不再指向的槽位：刷新后停止使用，已读到旧指针的写入仍然有效
+	for (int32 RouteSlot = ResolvedRoutes.Num(); RouteSlot < MaxRoutes; ++RouteSlot)
+	{
+		if (bq::LogEverythingLogger* Logger = RouteLoggers[RouteSlot].Instance.exchange(nullptr, std::memory_order_acq_rel))
+		{
+			Logger->force_flush();
+		}
+	}
+
+	if (ResolvedRoutes.Num() > 0)
+	{
+		LE_SYSTEM_LOG(TEXT("%d log routes active"), ResolvedRoutes.Num());
+	}
+	return bAllApplied;
+}
+
+bool FLEBqLogBridge::SetRoutes(const TArray<FLELogRoute>& Routes)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	CurrentSettings.Routes = Routes;
+	if (!bIsInitialized)
+	{
+		return true;
+	}
+	return UpdateRouteLoggers();
+}
+
+TArray<FLELogRoute> FLEBqLogBridge::GetRoutes() const
+{
+	FScopeLock Lock(&CriticalSection);
+	return CurrentSettings.Routes;
+}
+
+int32 FLEBqLogBridge::GetResolvedRoute(uint32 CategoryIndex, ELELogVerbosity Level) const
+{
+	FScopeLock Lock(&CriticalSection);
+
+	if (CategoryIndex >= static_cast<uint32>(LogEverythingGenerated::CategoryCount) || static_cast<uint8>(Level) >= NumLevels)
+	{
+		return INDEX_NONE;
+	}
+
+	// 查找表存放的是槽位，槽位按顺序对应有效路由；需要换算回 CurrentSettings.Routes 的下标
+	const uint8 Route = RouteTable[CategoryIndex * NumLevels + static_cast<uint8>(Level)].load(std::memory_order_relaxed);
+	return Route == 0 ? INDEX_NONE : RouteSlotToIndex[Route - 1];
+}
+
+bool FLEBqLogBridge::UpdateReliableLogger()
+{
+	const FLELogReliabilityPolicy& Policy = CurrentSettings.ReliabilityPolicy;
+	if (!Policy.RequiresGuaranteedLogger())
+	{
+		if (bq::LogEverythingLogger* Logger = ReliableLogger.Instance.exchange(nullptr, std::memory_order_acq_rel))
+		{
+			Logger->force_flush();
+		}
+		return true;
+	}
+
+	const FLEBqLogConfig ReliableConfig = LogEverything::Private::BuildReliableConfig(BaseConfig, AbsoluteLogPath, Policy);
+	TArray<FString> ConfigErrors;
+	if (!ReliableConfig.Validate(&ConfigErrors))
+	{
+		LE_SYSTEM_ERROR(TEXT("Invalid reliable BqLog config: %s"), *FString::Join(ConfigErrors, TEXT("; ")));
+		return false;
+	}
+
+	if (!CreateOrUpdateLogger(ReliableLogger, ReliableConfig))
+	{
+		LE_SYSTEM_ERROR(TEXT("Failed to create the reliable BqLog logger, Guaranteed levels fall back to Block"));
+		return false;
+	}
+	return true;
+}
+
+bool FLEBqLogBridge::SetReliabilityPolicy(const FLELogReliabilityPolicy& Policy)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	CurrentSettings.ReliabilityPolicy = Policy;
+	const bool bResult = !bIsInitialized || UpdateReliableLogger();
+
+	// 先准备好高可靠 logger 再发布策略，发射路径看到 Guaranteed 时副本目标已经就绪
+	PublishReliabilityPolicy(Policy);
+	LE_SYSTEM_LOG(TEXT("Reliability policy set to: %s"), *Policy.ToString());
+	return bResult;
+}
+
+FLELogReliabilityPolicy FLEBqLogBridge::GetReliabilityPolicy() const
+{
+	FScopeLock Lock(&CriticalSection);
+	return CurrentSettings.ReliabilityPolicy;
+}
+
+void FLEBqLogBridge::PublishReliabilityPolicy(const FLELogReliabilityPolicy& Policy)
+{
+	for (uint8 Level = 0; Level <= static_cast<uint8>(ELELogVerbosity::Fatal); ++Level)
+	{
+		LevelReliability[Level].store(static_cast<uint8>(Policy.GetForLevel(static_cast<ELELogVerbosity>(Level))), std::memory_order_relaxed);
+	}
+	BlockTimeoutCycles.store(static_cast<uint64>(FMath::Max(Policy.BlockTimeoutMs, 0) / 1000.0 / FPlatformTime::GetSecondsPerCycle64()), std::memory_order_relaxed);
+}
+
+void FLEBqLogBridge::OnEntryDropped(uint32 CategoryIndex, ELELogVerbosity Level)
+{
+	FLEDropCounters::RecordDrop(CategoryIndex, Level);
+}
+
+uint64 FLEBqLogBridge::GetDroppedEntryCount() const
+{
+	return FLEDropCounters::GetTotal();
+}
+
+void FLEBqLogBridge::WriteDropSummary(const bq::LogEverythingLogger& Logger, uint32 CategoryIndex, bq::log_level Level)
+{
+	using LogEverything::Private::FBqLogAccess;
+
+	// 限速：同一时刻只有抢到时间窗口的线程写汇总
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+	uint64 NextCycles = NextDropSummaryCycles.load(std::memory_order_relaxed);
+	if (NowCycles < NextCycles
+		|| !NextDropSummaryCycles.compare_exchange_strong(NextCycles, NowCycles + static_cast<uint64>(1.0 / FPlatformTime::GetSecondsPerCycle64()), std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	const uint64 Dropped = FLEDropCounters::ConsumeUnreported();
+	if (Dropped == 0)
+	{
+		return;
+	}
+
+	const TCHAR* const SummaryFormat = TEXT("LogEverything: {} entries dropped since the last summary ({} in total), BqLog buffer was full");
+	const uint64 TotalDropped = FLEDropCounters::GetTotal();
+	if (!FBqLogAccess::DoLog(Logger, 0, bq::log_level::warning, SummaryFormat, Dropped, TotalDropped)
+		&& !FBqLogAccess::DoLog(Logger, CategoryIndex, Level, SummaryFormat, Dropped, TotalDropped))
+	{
+		// 又一次写满，留给下一次成功的写入报告
+		FLEDropCounters::RestoreUnreported(Dropped);
+	}
+}
+
+bool FLEBqLogBridge::CreateOrUpdateLogger(FLoggerSlot& Slot, const FLEBqLogConfig& Config)
+{
+	TArray<uint8> ConfigUTF8 = FStringToUTF8(Config.ToString());
+	ConfigUTF8.Add(0);
+	const bq::string BqLogConfig((const char*)ConfigUTF8.GetData());
+
+	// 线程模式与缓冲区大小只在创建时生效，其余配置（appender、级别、掩码）可以原地 reset_config
+	bq::LogEverythingLogger* CurrentLogger = Slot.Handles.Num() > 0 ? Slot.Handles.Last().Get() : nullptr;
+	const bool bCanReset = CurrentLogger
+		&& Slot.CreationConfig.ThreadMode == Config.ThreadMode
+		&& Slot.CreationConfig.BufferSize == Config.BufferSize
+		&& Slot.CreationConfig.ReliableLevel == Config.ReliableLevel;
+	if (bCanReset)
 	{
-		ConfigUTF8.Add(0);
+		if (CurrentLogger->reset_config(BqLogConfig))
+		{
+			Slot.Instance.store(CurrentLogger, std::memory_order_release);
+			return true;
+		}
+		LE_SYSTEM_WARNING(TEXT("reset_config rejected the new BqLog config, recreating the logger"));
 	}
 
-	LE_SYSTEM_LOG(TEXT("ConfigUTF8 length: %d"), ConfigUTF8.Num());
-	bq::string BqLogConfig((const char*)ConfigUTF8.GetData());
+	// BqLog 按名称复用 logger，每一代使用新名称才能得到新的缓冲区与线程模式
+	const FString LoggerName = Slot.Handles.Num() == 0
+		? Slot.BaseName
+		: FString::Printf(TEXT("%s_%d"), *Slot.BaseName, Slot.Handles.Num());
+	TArray<uint8> NameUTF8 = FStringToUTF8(LoggerName);
+	NameUTF8.Add(0);
 
-	// 使用配置字符串创建 LogEverythingLogger 实例
-	static bq::LogEverythingLogger CategoryLogInstanceStatic = bq::LogEverythingLogger::create_log(
-		bq::string("LogEverythingLogger"),
-		BqLogConfig
-	);
+	TUniquePtr<bq::LogEverythingLogger> NewLogger = MakeUnique<bq::LogEverythingLogger>(
+		bq::LogEverythingLogger::create_log(bq::string((const char*)NameUTF8.GetData()), BqLogConfig));
+	if (!NewLogger->is_valid())
+	{
+		LE_SYSTEM_ERROR(TEXT("Failed to create BqLog Category Log instance %s"), *LoggerName);
+		return false;
+	}
+
+	// 先切换再刷新旧实例：切换前已读到旧指针的写入仍落在旧 logger 中，由其工作线程或这次刷新输出
+	bq::LogEverythingLogger* PreviousLogger = Slot.Instance.exchange(NewLogger.Get(), std::memory_order_acq_rel);
+	if (PreviousLogger)
+	{
+		PreviousLogger->force_flush();
+	}
+
+	LE_SYSTEM_LOG(TEXT("BqLog Category Log instance %s created successfully with %d categories"),
+		*LoggerName, static_cast<int32>(NewLogger->get_categories_count()));
+	Slot.Handles.Add(MoveTemp(NewLogger));
+	Slot.CreationConfig = Config;
+	return true;
+}
+
+bool FLEBqLogBridge::Reconfigure(const FLELogSettings& Settings)
+{
+	FScopeLock Lock(&CriticalSection);
 
-	// 保存实例指针
-	CategoryLogInstance = &CategoryLogInstanceStatic;
+	if (!bIsInitialized)
+	{
+		LE_SYSTEM_WARNING(TEXT("FLEBqLogBridge is not initialized, cannot reconfigure"));
+		return false;
+	}
 
-	if (!CategoryLogInstance || !CategoryLogInstance->is_valid())
+	// 过滤模式与当前级别/掩码由分类树维护，这里只替换 appender、线程模式、缓冲区与可靠性策略
+	FLELogSettings NewSettings = Settings;
+	NewSettings.FilterMode = CurrentSettings.FilterMode;
+	const FLELogSettings PreviousSettings = CurrentSettings;
+	CurrentSettings = NewSettings;
+	if (!SetupBqLogConfig(NewSettings))
 	{
-		LE_SYSTEM_ERROR(TEXT("Failed to create BqLog Category Log instance"));
-		CategoryLogInstance = nullptr;
+		CurrentSettings = PreviousSettings;
 		return false;
 	}
 
-	LE_SYSTEM_LOG(TEXT("BqLog Category Log instance created successfully with %d categories"), CategoryLogInstance->get_categories_count());
+	PublishReliabilityPolicy(NewSettings.ReliabilityPolicy);
+	LogEverything::InvalidateCallSites();
+	LE_SYSTEM_LOG(TEXT("FLEBqLogBridge reconfigured"));
 	return true;
 }
 
+void FLEBqLogBridge::PublishNativeFilterSnapshot(const FLECategoryFilterSnapshot* NewSnapshot)
+{
+	const FLECategoryFilterSnapshot* OldSnapshot = NativeFilterSnapshot.exchange(NewSnapshot, std::memory_order_seq_cst);
+	FLEEpochReclaimer::Retire(OldSnapshot);
+}
+
+FLEBqLogConfig FLEBqLogBridge::ApplyNativeFilterConfig(const FLEBqLogConfig& Config) const
+{
+	// 设置决定 appender 与线程模式，过滤模式决定级别列表与分类掩码
+	// 放宽期间 BqLog 全开，分类阈值完全由调用点的字节表判断
+	FLEBqLogConfig FilteredConfig = Config;
+	FilteredConfig.SetLevels(bNativeFilterRelaxed ? FString(LogEverything::Private::AllLevelsConfig) : NativeLevelsConfig);
+	FilteredConfig.CategoriesMask = bNativeFilterRelaxed ? FString(LogEverything::Private::AllCategoriesMaskConfig) : NativeCategoriesMaskConfig;
+	return FilteredConfig;
+}
+
+FString FLEBqLogBridge::BuildBqLogConfigString() const
+{
+	return ApplyNativeFilterConfig(BaseConfig).ToString();
+}
+
+bool FLEBqLogBridge::ResetBqLogConfig()
+{
+	bq::LogEverythingLogger* Logger = MainLogger.Instance.load(std::memory_order_acquire);
+	if (!Logger)
+	{
+		return false;
+	}
+
+	TArray<uint8> ConfigUTF8 = FStringToUTF8(BuildBqLogConfigString());
+	ConfigUTF8.Add(0);
+
+	bool bResult = Logger->reset_config(bq::string((const char*)ConfigUTF8.GetData()));
+	if (!bResult)
+	{
+		LE_SYSTEM_ERROR(TEXT("Failed to reset BqLog config (levels: %s, categories_mask: %s)"),
+			*NativeLevelsConfig, *NativeCategoriesMaskConfig);
+	}
+
+	// 路由 logger 与主 logger 共享原生过滤配置，is_enable_for 的结果与选择哪个 logger 无关
+	for (int32 RouteSlot = 0; RouteSlot < MaxRoutes; ++RouteSlot)
+	{
+		bq::LogEverythingLogger* RouteLogger = RouteLoggers[RouteSlot].Instance.load(std::memory_order_acquire);
+		if (!RouteLogger)
+		{
+			continue;
+		}
+
+		TArray<uint8> RouteConfigUTF8 = FStringToUTF8(ApplyNativeFilterConfig(RouteBaseConfigs[RouteSlot]).ToString());
+		RouteConfigUTF8.Add(0);
+		if (!RouteLogger->reset_config(bq::string((const char*)RouteConfigUTF8.GetData())))
+		{
+			LE_SYSTEM_ERROR(TEXT("Failed to reset BqLog config of route logger %s"), *RouteLoggers[RouteSlot].BaseName);
+			bResult = false;
+		}
+	}
+
+	return bResult;
+}
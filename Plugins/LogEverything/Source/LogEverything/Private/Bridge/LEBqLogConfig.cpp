@@ -0,0 +1,261 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Bridge/LEBqLogConfig.h"
+#include "Utils/LogEverythingUtils.h"
+#include "String/ParseTokens.h"
+
+namespace
+{
+	const FStringView AppendersPrefix = TEXTVIEW("appenders_config.");
+
+	/** BqLog 接受的缓冲区范围，与 FLELogSettings::BufferSize 的 ClampMin / ClampMax 一致 */
+	constexpr int32 MinBufferSize = 1024;
+	constexpr int32 MaxBufferSize = 64 * 1024 * 1024;
+
+	bool IsValidAppenderType(const FString& Type)
+	{
+		return Type == TEXT("console") || Type == TEXT("text_file") || Type == TEXT("raw_file") || Type == TEXT("compressed_file");
+	}
+
+	/** 添加 appender，同一类型只保留一个 */
+	void AddAppender(FLEBqLogConfig& Config, const TCHAR* Type, const FString& FileName, int64 MaxFileSize)
+	{
+		if (Config.Appenders.ContainsByPredicate([Type](const FLEBqLogAppenderConfig& Appender) { return Appender.Type == Type; }))
+		{
+			return;
+		}
+
+		FLEBqLogAppenderConfig& Appender = Config.Appenders.AddDefaulted_GetRef();
+		Appender.Name = FString::Printf(TEXT("appender_%d"), Config.Appenders.Num() - 1);
+		Appender.Type = Type;
+		if (Appender.IsFileAppender())
+		{
+			Appender.FileName = FileName;
+			Appender.MaxFileSize = MaxFileSize;
+		}
+	}
+}
+
+bool FLEBqLogAppenderConfig::IsFileAppender() const
+{
+	return Type == TEXT("text_file") || Type == TEXT("raw_file") || Type == TEXT("compressed_file");
+}
+
+FLEBqLogConfig FLEBqLogConfig::FromSettings(const FLELogSettings& Settings, const FString& FileBasePath)
+{
+	FLEBqLogConfig Config;
+	Config.ThreadMode = !Settings.bEnableAsyncLogging ? TEXT("sync")
+		: Settings.bUseIndependentLogThread ? TEXT("independent")
+		: TEXT("async");
+	Config.BufferSize = Settings.BufferSize;
+
+	const int64 MaxFileSize = static_cast<int64>(FMath::Max(Settings.MaxLogFileSizeMB, 0)) * 1024 * 1024;
+	for (const ELELogOutput Output : Settings.OutputTargets)
+	{
+		switch (Output)
+		{
+		case ELELogOutput::Console:
+			AddAppender(Config, TEXT("console"), FileBasePath, MaxFileSize);
+			break;
+		case ELELogOutput::File:
+			AddAppender(Config, Settings.bEnableCompression ? TEXT("compressed_file") : TEXT("text_file"), FileBasePath, MaxFileSize);
+			break;
+		case ELELogOutput::Compressed:
+			AddAppender(Config, TEXT("compressed_file"), FileBasePath, MaxFileSize);
+			break;
+		case ELELogOutput::Raw:
+			AddAppender(Config, TEXT("raw_file"), FileBasePath, MaxFileSize);
+			break;
+		default:
+			LE_SYSTEM_WARNING(TEXT("Output target %s has no BqLog appender, skipped"), *UEnum::GetValueAsString(Output));
+			break;
+		}
+	}
+
+	return Config;
+}
+
+void FLEBqLogConfig::SetLevels(const FString& Levels)
+{
+	for (FLEBqLogAppenderConfig& Appender : Appenders)
+	{
+		Appender.Levels = Levels;
+	}
+}
+
+bool FLEBqLogConfig::Validate(TArray<FString>* OutErrors) const
+{
+	TArray<FString> Errors;
+
+	if (ThreadMode != TEXT("sync") && ThreadMode != TEXT("async") && ThreadMode != TEXT("independent"))
+	{
+		Errors.Add(FString::Printf(TEXT("invalid thread_mode '%s'"), *ThreadMode));
+	}
+	if (BufferSize != 0 && (BufferSize < MinBufferSize || BufferSize > MaxBufferSize))
+	{
+		Errors.Add(FString::Printf(TEXT("buffer_size %d outside [%d, %d]"), BufferSize, MinBufferSize, MaxBufferSize));
+	}
+	if (!ReliableLevel.IsEmpty() && ReliableLevel != TEXT("low") && ReliableLevel != TEXT("normal") && ReliableLevel != TEXT("high"))
+	{
+		Errors.Add(FString::Printf(TEXT("invalid reliable_level '%s'"), *ReliableLevel));
+	}
+	if (CategoriesMask.IsEmpty())
+	{
+		Errors.Add(TEXT("empty categories_mask"));
+	}
+	if (Appenders.IsEmpty())
+	{
+		Errors.Add(TEXT("no appenders"));
+	}
+
+	TSet<FString> Names;
+	for (const FLEBqLogAppenderConfig& Appender : Appenders)
+	{
+		bool bDuplicateName = false;
+		Names.Add(Appender.Name, &bDuplicateName);
+		if (Appender.Name.IsEmpty() || bDuplicateName)
+		{
+			Errors.Add(FString::Printf(TEXT("invalid or duplicate appender name '%s'"), *Appender.Name));
+		}
+		if (!IsValidAppenderType(Appender.Type))
+		{
+			Errors.Add(FString::Printf(TEXT("%s: invalid type '%s'"), *Appender.Name, *Appender.Type));
+		}
+		if (Appender.IsFileAppender() && Appender.FileName.IsEmpty())
+		{
+			Errors.Add(FString::Printf(TEXT("%s: file appender without file_name"), *Appender.Name));
+		}
+		if (Appender.MaxFileSize < 0)
+		{
+			Errors.Add(FString::Printf(TEXT("%s: negative max_file_size"), *Appender.Name));
+		}
+		if (Appender.Levels.IsEmpty())
+		{
+			Errors.Add(FString::Printf(TEXT("%s: empty levels"), *Appender.Name));
+		}
+	}
+
+	if (OutErrors)
+	{
+		*OutErrors = MoveTemp(Errors);
+		return OutErrors->IsEmpty();
+	}
+	return Errors.IsEmpty();
+}
+
+FString FLEBqLogConfig::ToString() const
+{
+	TStringBuilder<1024> Builder;
+	for (const FLEBqLogAppenderConfig& Appender : Appenders)
+	{
+		Builder.Appendf(TEXT("%s%s.type=%s\n"), *FString(AppendersPrefix), *Appender.Name, *Appender.Type);
+		if (Appender.IsFileAppender())
+		{
+			Builder.Appendf(TEXT("%s%s.file_name=%s\n"), *FString(AppendersPrefix), *Appender.Name, *Appender.FileName);
+			if (Appender.MaxFileSize > 0)
+			{
+				Builder.Appendf(TEXT("%s%s.max_file_size=%lld\n"), *FString(AppendersPrefix), *Appender.Name, Appender.MaxFileSize);
+			}
+		}
+		Builder.Appendf(TEXT("%s%s.levels=%s\n"), *FString(AppendersPrefix), *Appender.Name, *Appender.Levels);
+	}
+
+	Builder.Appendf(TEXT("log.thread_mode=%s\n"), *ThreadMode);
+	if (BufferSize > 0)
+	{
+		Builder.Appendf(TEXT("log.buffer_size=%d\n"), BufferSize);
+	}
+	if (!ReliableLevel.IsEmpty())
+	{
+		Builder.Appendf(TEXT("log.reliable_level=%s\n"), *ReliableLevel);
+	}
+	Builder.Appendf(TEXT("log.categories_mask=%s"), *CategoriesMask);
+	return FString(Builder.ToView());
+}
+
+bool FLEBqLogConfig::Parse(FStringView ConfigText, FLEBqLogConfig& OutConfig)
+{
+	static const TCHAR LineDelimiters[] = { TEXT('\r'), TEXT('\n') };
+
+	FLEBqLogConfig Config;
+	Config.BufferSize = 0;
+	bool bValid = true;
+
+	UE::String::ParseTokensMultiple(ConfigText, MakeArrayView(LineDelimiters, UE_ARRAY_COUNT(LineDelimiters)), [&Config, &bValid](FStringView Line)
+	{
+		Line.TrimStartAndEndInline();
+		if (Line.IsEmpty() || Line.StartsWith(TEXT('#')))
+		{
+			return;
+		}
+
+		int32 EqualsIndex = INDEX_NONE;
+		if (!Line.FindChar(TEXT('='), EqualsIndex))
+		{
+			bValid = false;
+			return;
+		}
+
+		const FStringView Key = Line.Left(EqualsIndex).TrimStartAndEnd();
+		const FString Value(Line.RightChop(EqualsIndex + 1).TrimStartAndEnd());
+
+		if (Key == TEXTVIEW("log.thread_mode"))
+		{
+			Config.ThreadMode = Value;
+		}
+		else if (Key == TEXTVIEW("log.buffer_size"))
+		{
+			Config.BufferSize = FCString::Atoi(*Value);
+		}
+		else if (Key == TEXTVIEW("log.reliable_level"))
+		{
+			Config.ReliableLevel = Value;
+		}
+		else if (Key == TEXTVIEW("log.categories_mask"))
+		{
+			Config.CategoriesMask = Value;
+		}
+		else if (Key.StartsWith(AppendersPrefix))
+		{
+			const FStringView AppenderKey = Key.RightChop(AppendersPrefix.Len());
+			int32 DotIndex = INDEX_NONE;
+			if (!AppenderKey.FindChar(TEXT('.'), DotIndex))
+			{
+				bValid = false;
+				return;
+			}
+
+			const FString Name(AppenderKey.Left(DotIndex));
+			const FStringView Field = AppenderKey.RightChop(DotIndex + 1);
+			FLEBqLogAppenderConfig* Appender = Config.Appenders.FindByPredicate([&Name](const FLEBqLogAppenderConfig& Existing) { return Existing.Name == Name; });
+			if (!Appender)
+			{
+				Appender = &Config.Appenders.AddDefaulted_GetRef();
+				Appender->Name = Name;
+			}
+
+			if (Field == TEXTVIEW("type"))
+			{
+				Appender->Type = Value;
+			}
+			else if (Field == TEXTVIEW("file_name"))
+			{
+				Appender->FileName = Value;
+			}
+			else if (Field == TEXTVIEW("max_file_size"))
+			{
+				Appender->MaxFileSize = FCString::Atoi64(*Value);
+			}
+			else if (Field == TEXTVIEW("levels"))
+			{
+				Appender->Levels = Value;
+			}
+		}
+	}, UE::String::EParseTokensOptions::SkipEmpty);
+
+	if (bValid)
+	{
+		OutConfig = MoveTemp(Config);
+	}
+	return bValid;
+}
@@ -0,0 +1,177 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Category/LECategoryRules.h"
+#include "Utils/LogEverythingUtils.h"
+#include "String/ParseTokens.h"
+
+namespace
+{
+	/** 多组件通配符 */
+	const FStringView AnyComponentsToken = TEXTVIEW("**");
+
+	/** 单个组件内的通配匹配：'*' 匹配任意字符序列，'?' 匹配单个字符，大小写不敏感 */
+	bool MatchComponent(FStringView Pattern, FStringView Text)
+	{
+		int32 PatternIndex = 0;
+		int32 TextIndex = 0;
+		int32 StarPatternIndex = INDEX_NONE;
+		int32 StarTextIndex = 0;
+
+		while (TextIndex < Text.Len())
+		{
+			if (PatternIndex < Pattern.Len() && Pattern[PatternIndex] == TEXT('*'))
+			{
+				StarPatternIndex = PatternIndex++;
+				StarTextIndex = TextIndex;
+			}
+			else if (PatternIndex < Pattern.Len()
+				&& (Pattern[PatternIndex] == TEXT('?') || FChar::ToLower(Pattern[PatternIndex]) == FChar::ToLower(Text[TextIndex])))
+			{
+				++PatternIndex;
+				++TextIndex;
+			}
+			else if (StarPatternIndex != INDEX_NONE)
+			{
+				// 回溯：让上一个 '*' 多吃一个字符
+				PatternIndex = StarPatternIndex + 1;
+				TextIndex = ++StarTextIndex;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		while (PatternIndex < Pattern.Len() && Pattern[PatternIndex] == TEXT('*'))
+		{
+			++PatternIndex;
+		}
+		return PatternIndex == Pattern.Len();
+	}
+
+	/** 组件序列匹配：与字符匹配同构，"**" 充当组件级的 '*' */
+	bool MatchComponents(TConstArrayView<FString> Pattern, TConstArrayView<FStringView> Path)
+	{
+		int32 PatternIndex = 0;
+		int32 PathIndex = 0;
+		int32 StarPatternIndex = INDEX_NONE;
+		int32 StarPathIndex = 0;
+
+		while (PathIndex < Path.Num())
+		{
+			if (PatternIndex < Pattern.Num() && Pattern[PatternIndex] == AnyComponentsToken)
+			{
+				StarPatternIndex = PatternIndex++;
+				StarPathIndex = PathIndex;
+			}
+			else if (PatternIndex < Pattern.Num() && MatchComponent(Pattern[PatternIndex], Path[PathIndex]))
+			{
+				++PatternIndex;
+				++PathIndex;
+			}
+			else if (StarPatternIndex != INDEX_NONE)
+			{
+				PatternIndex = StarPatternIndex + 1;
+				PathIndex = ++StarPathIndex;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		while (PatternIndex < Pattern.Num() && Pattern[PatternIndex] == AnyComponentsToken)
+		{
+			++PatternIndex;
+		}
+		return PatternIndex == Pattern.Num();
+	}
+}
+
+bool FLECategoryRule::Parse(FStringView RuleText, FLECategoryRule& OutRule)
+{
+	RuleText.TrimStartAndEndInline();
+
+	FLECategoryRule Rule;
+	FStringView PatternText = RuleText;
+	if (RuleText.StartsWith(TEXT('!')))
+	{
+		Rule.bDisable = true;
+		PatternText = RuleText.RightChop(1);
+	}
+	else
+	{
+		int32 EqualsIndex = INDEX_NONE;
+		if (!RuleText.FindLastChar(TEXT('='), EqualsIndex)
+			|| !LELogVerbosityUtils::TryParse(RuleText.RightChop(EqualsIndex + 1).TrimStartAndEnd(), Rule.Level))
+		{
+			return false;
+		}
+		PatternText = RuleText.Left(EqualsIndex);
+	}
+
+	PatternText.TrimStartAndEndInline();
+	if (PatternText.IsEmpty())
+	{
+		return false;
+	}
+
+	// 组件不能为空，"**" 只能作为完整组件出现
+	bool bValid = true;
+	UE::String::ParseTokens(PatternText, TEXT('.'), [&Rule, &bValid](FStringView Component)
+	{
+		if (Component.IsEmpty() || (Component != AnyComponentsToken && Component.Contains(AnyComponentsToken)))
+		{
+			bValid = false;
+		}
+		Rule.PatternComponents.Emplace(Component);
+	});
+	if (!bValid)
+	{
+		return false;
+	}
+
+	Rule.Pattern = FString(PatternText);
+	OutRule = MoveTemp(Rule);
+	return true;
+}
+
+bool FLECategoryRule::ParseList(FStringView RulesText, TArray<FLECategoryRule>& OutRules)
+{
+	static const TCHAR Delimiters[] = { TEXT(';'), TEXT(','), TEXT(' '), TEXT('\t'), TEXT('\r'), TEXT('\n') };
+
+	bool bAllValid = true;
+	UE::String::ParseTokensMultiple(RulesText, MakeArrayView(Delimiters, UE_ARRAY_COUNT(Delimiters)), [&OutRules, &bAllValid](FStringView RuleText)
+	{
+		FLECategoryRule Rule;
+		if (Parse(RuleText, Rule))
+		{
+			OutRules.Add(MoveTemp(Rule));
+		}
+		else
+		{
+			LE_SYSTEM_WARNING(TEXT("Invalid category rule: %s"), *FString(RuleText));
+			bAllValid = false;
+		}
+	}, UE::String::EParseTokensOptions::SkipEmpty);
+
+	return bAllValid;
+}
+
+bool FLECategoryRule::Matches(FStringView CategoryPath) const
+{
+	TArray<FStringView, TInlineAllocator<16>> PathComponents;
+	UE::String::ParseTokens(CategoryPath, TEXT('.'), [&PathComponents](FStringView Component)
+	{
+		PathComponents.Add(Component);
+	}, UE::String::EParseTokensOptions::SkipEmpty);
+
+	return MatchComponents(PatternComponents, PathComponents);
+}
+
+FString FLECategoryRule::ToString() const
+{
+	return bDisable
+		? FString::Printf(TEXT("!%s"), *Pattern)
+		: FString::Printf(TEXT("%s=%s"), *Pattern, LELogVerbosityUtils::ToString(Level));
+}
@@ -0,0 +1,1225 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Category/LECategoryTreeCore.h"
+#include "Category/LECategoryTree.h"
+#include "Category/LECategoryRules.h"
+#include "Utils/LogEverythingUtils.h"
+#include "Bridge/LEBqLogBridge.h"
+#include "System/LEFilterState.h"
+#include "System/LELogCallSite.h"
+#include "Engine/Engine.h"
+#include "String/ParseTokens.h"
+
+namespace
+{
+	/** 按前序映射重排一个结构数组：新数组第 i 个元素取自旧数组 NewToOld[i] */
+	template <typename ArrayType>
+	void PermuteNodeArray(ArrayType& Array, const TArray<int32>& NewToOld)
+	{
+		ArrayType Permuted;
+		Permuted.Reserve(NewToOld.Num());
+		for (int32 OldIndex : NewToOld)
+		{
+			Permuted.Add(MoveTemp(Array[OldIndex]));
+		}
+		Array = MoveTemp(Permuted);
+	}
+
+	FORCEINLINE int32 RemapNodeIndex(int32 OldIndex, const TArray<int32>& OldToNew)
+	{
+		return OldIndex != INDEX_NONE ? OldToNew[OldIndex] : INDEX_NONE;
+	}
+}
+
+FLECategoryTreeCore::FLECategoryTreeCore()
+	: RootNodeIndex(INDEX_NONE)
+	, TreeVersion(0)
+	, bLayoutDirty(false)
+{
+}
+
+FLECategoryTreeCore::~FLECategoryTreeCore()
+{
+	// 最后一个持有者释放时离开进程级过滤状态；FLEFilterState 只做身份比较，不持有引用
+	if (FLEFilterState::IsActiveTree(this))
+	{
+		FLEFilterState::SetActiveTree(nullptr);
+	}
+	PublishFilterSnapshot(nullptr);
+}
+
+bool FLECategoryTreeCore::InitializeTree(const TArray<FString>& CategoryPaths)
+{
+	FScopeLock Lock(&TreeLock);
+
+	// 清空现有数据
+	NodeFilterBytes.Empty();
+	EffectiveLevels.Empty();
+	EnabledFlags.Empty();
+	EffectiveEnabledFlags.Empty();
+	ExplicitLevels.Empty();
+	HasExplicitLevelFlags.Empty();
+	RuleFlags.Empty();
+	NodeLinks.Empty();
+	FullNames.Empty();
+	SubNames.Empty();
+	PathToIndexMap.Empty();
+	ChildLookup.Empty();
+	BqIndexToNodeIndex.Empty();
+	PublishFilterSnapshot(nullptr);
+	TreeVersion = 0;
+	bLayoutDirty = false;
+
+	// 创建根节点
+	CreateRootNode();
+
+	// 添加所有分类路径
+	bool bSuccess = true;
+	for (const FString& Path : CategoryPaths)
+	{
+		if (!Path.IsEmpty())
+		{
+			int32 NodeIndex = FindOrCreateNode(Path);
+			if (NodeIndex == INDEX_NONE)
+			{
+				LE_SYSTEM_WARNING(TEXT("Failed to create node for path: %s"), *Path);
+				bSuccess = false;
+			}
+		}
+	}
+
+	IncrementVersion();
+	LE_SYSTEM_LOG(TEXT("Category tree initialized with %d nodes, success: %s"),
+		NodeLinks.Num(), bSuccess ? TEXT("true") : TEXT("false"));
+
+	return bSuccess;
+}
+
+bool FLECategoryTreeCore::InitializeFromTables(const FLECategoryTreeTables& Tables)
+{
+	FScopeLock Lock(&TreeLock);
+
+	const int32 NumNodes = Tables.NumCategories;
+	if (NumNodes <= 0 || !Tables.NodeLinks || Tables.NodeLinks[0].ParentIndex != INDEX_NONE || Tables.NodeLinks[0].SubtreeEnd != NumNodes)
+	{
+		LE_SYSTEM_WARNING(TEXT("Invalid category tree tables, cannot bootstrap"));
+		return false;
+	}
+
+	PublishFilterSnapshot(nullptr);
+	TreeVersion = 0;
+	bLayoutDirty = false;
+	RootNodeIndex = 0;
+
+	// 结构数据：表已是前序布局，整块复制
+	NodeLinks.SetNumUninitialized(NumNodes);
+	FMemory::Memcpy(NodeLinks.GetData(), Tables.NodeLinks, NumNodes * sizeof(FLECategoryNodeLinks));
+
+	// 级别数据：根节点显式 Info，其余继承 Info
+	NodeFilterBytes.SetNumUninitialized(NumNodes);
+	FMemory::Memset(NodeFilterBytes.GetData(), static_cast<uint8>(ELELogVerbosity::Info), NumNodes);
+	EffectiveLevels.Init(ELELogVerbosity::Info, NumNodes);
+	EnabledFlags.Init(true, NumNodes);
+	EffectiveEnabledFlags.Init(true, NumNodes);
+	ExplicitLevels.Init(ELELogVerbosity::NoLogging, NumNodes);
+	HasExplicitLevelFlags.Init(false, NumNodes);
+	ExplicitLevels[RootNodeIndex] = ELELogVerbosity::Info;
+	HasExplicitLevelFlags[RootNodeIndex] = true;
+	RuleFlags.Init(0, NumNodes);
+
+	// 命名数据：只注册 FName，子名称直接引用完整名称的后缀
+	FullNames.Reset(NumNodes);
+	SubNames.Reset(NumNodes);
+	PathToIndexMap.Reset();
+	PathToIndexMap.Reserve(NumNodes);
+	ChildLookup.Reset();
+	ChildLookup.Reserve(NumNodes);
+	BqIndexToNodeIndex.SetNumUninitialized(NumNodes);
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		const TCHAR* FullName = Tables.FullNames[NodeIndex];
+		const int32 SubNameOffset = Tables.SubNameOffsets[NodeIndex];
+		const FName FullFName(Tables.FullNameLengths[NodeIndex], FullName);
+
+		FullNames.Add(FullFName);
+		SubNames.Add(FName(Tables.FullNameLengths[NodeIndex] - SubNameOffset, FullName + SubNameOffset));
+		PathToIndexMap.Add(FullFName, NodeIndex);
+		if (NodeLinks[NodeIndex].ParentIndex != INDEX_NONE)
+		{
+			ChildLookup.Add(FLECategoryChildKey{ NodeLinks[NodeIndex].ParentIndex, SubNames[NodeIndex] }, NodeIndex);
+		}
+		BqIndexToNodeIndex[NodeIndex] = NodeIndex;
+	}
+
+	// 表直接复制、不经过 AddNode，已设置的分类规则在这里整体编译
+	if (CategoryRules.Num() > 0)
+	{
+		CompileCategoryRules();
+	}
+
+	IncrementVersion();
+	LE_SYSTEM_LOG(TEXT("Category tree bootstrapped from generated tables with %d nodes"), NumNodes);
+
+	return true;
+}
+
+int32 FLECategoryTreeCore::RegisterCategories(TConstArrayView<FString> CategoryPaths)
+{
+	FScopeLock Lock(&TreeLock);
+
+	const int32 NumNodesBefore = NodeLinks.Num();
+	for (const FString& Path : CategoryPaths)
+	{
+		if (FindOrCreateNode(Path) == INDEX_NONE)
+		{
+			LE_SYSTEM_WARNING(TEXT("Failed to register category: %s"), *Path);
+		}
+	}
+
+	const int32 NumCreated = NodeLinks.Num() - NumNodesBefore;
+	if (NumCreated > 0)
+	{
+		IncrementVersion();
+		LE_SYSTEM_LOG(TEXT("Registered %d categories, %d new nodes"), CategoryPaths.Num(), NumCreated);
+	}
+
+	return NumCreated;
+}
+
+SIZE_T FLECategoryTreeCore::GetAllocatedSize() const
+{
+	FScopeLock Lock(&TreeLock);
+
+	return NodeFilterBytes.GetAllocatedSize()
+		+ EffectiveLevels.GetAllocatedSize()
+		+ EnabledFlags.GetAllocatedSize()
+		+ EffectiveEnabledFlags.GetAllocatedSize()
+		+ ExplicitLevels.GetAllocatedSize()
+		+ HasExplicitLevelFlags.GetAllocatedSize()
+		+ RuleFlags.GetAllocatedSize()
+		+ NodeLinks.GetAllocatedSize()
+		+ FullNames.GetAllocatedSize()
+		+ SubNames.GetAllocatedSize()
+		+ PathToIndexMap.GetAllocatedSize()
+		+ ChildLookup.GetAllocatedSize()
+		+ BqIndexToNodeIndex.GetAllocatedSize()
+		+ CategoryRules.GetAllocatedSize();
+}
+
+int32 FLECategoryTreeCore::ApplyTransaction(const FLECategoryTreeTransaction& Transaction)
+{
+	FScopeLock Lock(&TreeLock);
+
+	const TArray<FLECategoryTreeTransaction::FChange>& Changes = Transaction.GetChanges();
+	if (Changes.Num() == 0)
+	{
+		return 0;
+	}
+
+	// 第一步：解析路径，缺失的节点一次性创建，之后只重排一次
+	const int32 NumNodesBefore = NodeLinks.Num();
+	TArray<int32> ChangeNodeIndices;
+	ChangeNodeIndices.SetNumUninitialized(Changes.Num());
+	for (int32 ChangeIndex = 0; ChangeIndex < Changes.Num(); ++ChangeIndex)
+	{
+		ChangeNodeIndices[ChangeIndex] = FindOrCreateNode(Changes[ChangeIndex].CategoryPath);
+		if (ChangeNodeIndices[ChangeIndex] == INDEX_NONE)
+		{
+			LE_SYSTEM_WARNING(TEXT("Cannot find or create node for path: %s"), *Changes[ChangeIndex].CategoryPath);
+		}
+	}
+	const int32 NumCreated = NodeLinks.Num() - NumNodesBefore;
+	EnsurePreOrderLayout(INDEX_NONE, ChangeNodeIndices);
+
+	// 第二步：按暂存顺序写入显式级别与启用状态（后写覆盖先写），只记录受影响的前序区间，不做传播
+	int32 DirtyBegin = NodeLinks.Num();
+	int32 DirtyEnd = 0;
+	int32 NumLevelChanges = 0;
+	int32 NumEnabledChanges = 0;
+	for (int32 ChangeIndex = 0; ChangeIndex < Changes.Num(); ++ChangeIndex)
+	{
+		const int32 NodeIndex = ChangeNodeIndices[ChangeIndex];
+		if (!IsValidNodeIndex(NodeIndex))
+		{
+			continue;
+		}
+
+		const FLECategoryTreeTransaction::FChange& Change = Changes[ChangeIndex];
+		const int32 SubtreeEnd = NodeLinks[NodeIndex].SubtreeEnd;
+		const int32 RangeEnd = Change.bPropagate ? SubtreeEnd : NodeIndex + 1;
+		if (Change.Kind == FLECategoryTreeTransaction::EChangeKind::Level)
+		{
+			// 强制传播即整个子树都成为显式级别
+			for (int32 Index = NodeIndex; Index < RangeEnd; ++Index)
+			{
+				ExplicitLevels[Index] = Change.Level;
+			}
+			FMemory::Memset(HasExplicitLevelFlags.GetData() + NodeIndex, 1, (RangeEnd - NodeIndex) * sizeof(bool));
+			ClearRuleFlags(NodeIndex, RangeEnd, RuleFlagLevel);
+			++NumLevelChanges;
+		}
+		else
+		{
+			FMemory::Memset(EnabledFlags.GetData() + NodeIndex, Change.bEnabled ? 1 : 0, (RangeEnd - NodeIndex) * sizeof(bool));
+			ClearRuleFlags(NodeIndex, RangeEnd, RuleFlagDisabled);
+			++NumEnabledChanges;
+		}
+
+		DirtyBegin = FMath::Min(DirtyBegin, NodeIndex);
+		DirtyEnd = FMath::Max(DirtyEnd, SubtreeEnd);
+	}
+
+	// 第三步：一次线性扫描解析有效级别与有效启用状态并重算过滤字节，然后只发布一次
+	if (DirtyBegin < DirtyEnd)
+	{
+		ResolveEffectiveState(DirtyBegin, DirtyEnd);
+	}
+
+	const int32 NumApplied = NumLevelChanges + NumEnabledChanges;
+	if (NumApplied > 0 || NumCreated > 0)
+	{
+		IncrementVersion();
+	}
+
+	LE_SYSTEM_LOG(TEXT("Applied category transaction: %d level changes, %d enabled changes, %d new nodes, %d failed"),
+		NumLevelChanges, NumEnabledChanges, NumCreated, Changes.Num() - NumApplied);
+
+	return NumApplied;
+}
+
+void FLECategoryTreeCore::SetCategoryRules(TArray<FLECategoryRule> Rules)
+{
+	FScopeLock Lock(&TreeLock);
+
+	CategoryRules = MoveTemp(Rules);
+	EnsurePreOrderLayout();
+	const int32 NumMatched = CompileCategoryRules();
+
+	IncrementVersion();
+	LE_SYSTEM_LOG(TEXT("Compiled %d category rules, %d categories matched"), CategoryRules.Num(), NumMatched);
+}
+
+TArray<FLECategoryRule> FLECategoryTreeCore::GetCategoryRules() const
+{
+	FScopeLock Lock(&TreeLock);
+
+	return CategoryRules;
+}
+
+bool FLECategoryTreeCore::SetCategoryLevel(const FString& CategoryPath, ELELogVerbosity Level, bool bPropagate)
+{
+	FScopeLock Lock(&TreeLock);
+
+	int32 NodeIndex = FindNodeIndex(CategoryPath);
+	if (NodeIndex == INDEX_NONE)
+	{
+		// 如果节点不存在，尝试创建
+		NodeIndex = FindOrCreateNode(CategoryPath);
+		if (NodeIndex == INDEX_NONE)
+		{
+			LE_SYSTEM_WARNING(TEXT("Cannot find or create node for path: %s"), *CategoryPath);
+			return false;
+		}
+	}
+
+	// 传播依赖前序布局，新建节点后先重排（索引可能改变）
+	NodeIndex = EnsurePreOrderLayout(NodeIndex);
+	if (!IsValidNodeIndex(NodeIndex))
+	{
+		return false;
+	}
+
+	// 设置节点的显式级别（手动设置优先于规则，规则更新时不再撤销它）
+	ExplicitLevels[NodeIndex] = Level;
+	HasExplicitLevelFlags[NodeIndex] = true;
+	EffectiveLevels[NodeIndex] = Level;
+	RefreshNodeFilterBytes(NodeIndex, NodeIndex + 1);
+	ClearRuleFlags(NodeIndex, bPropagate ? NodeLinks[NodeIndex].SubtreeEnd : NodeIndex + 1, RuleFlagLevel);
+
+	// 根据传播选项更新子节点
+	if (bPropagate)
+	{
+		// 强制传播：覆盖所有子节点
+		UpdateChildrenEffectiveLevels(NodeIndex, Level, true);
+	}
+	else
+	{
+		// 智能继承：仅更新没有显式设置的子节点
+		UpdateChildrenEffectiveLevels(NodeIndex, Level, false);
+	}
+
+	IncrementVersion();
+	LE_SYSTEM_LOG(TEXT("Set category level: %s = %s (propagate: %s)"),
+		*CategoryPath, LELogVerbosityUtils::ToString(Level), bPropagate ? TEXT("true") : TEXT("false"));
+
+	return true;
+}
+
+ELELogVerbosity FLECategoryTreeCore::GetEffectiveLevel(const FString& CategoryPath) const
+{
+	FScopeLock Lock(&TreeLock);
+
+	int32 NodeIndex = FindNodeIndex(CategoryPath);
+	if (IsValidNodeIndex(NodeIndex))
+	{
+		// 直接返回枚举类型
+		return EffectiveLevels[NodeIndex];
+	}
+
+	// 如果找不到节点，返回默认级别
+	return ELELogVerbosity::Info;
+}
+
+bool FLECategoryTreeCore::ShouldLogCategory(const FName& CategoryName, ELELogVerbosity Level) const
+{
+	FScopeLock Lock(&TreeLock);
+
+	const int32* FoundIndex = PathToIndexMap.Find(CategoryName);
+	int32 NodeIndex = FoundIndex ? *FoundIndex : INDEX_NONE;
+
+	if (IsValidNodeIndex(NodeIndex))
+	{
+		// 过滤字节已合并启用状态（禁用时为 NoLogging），直接比较枚举值（值越小级别越低）
+		return static_cast<uint8>(Level) >= NodeFilterBytes[NodeIndex];
+	}
+
+	// 如果找不到节点，使用默认规则：Info 及以上级别显示
+	return static_cast<uint8>(Level) >= static_cast<uint8>(ELELogVerbosity::Warning);
+}
+
+int32 FLECategoryTreeCore::GetBqCategoryIndex(const FName& CategoryName) const
+{
+	FScopeLock Lock(&TreeLock);
+
+	const int32* FoundIndex = PathToIndexMap.Find(CategoryName);
+	return (FoundIndex && IsValidNodeIndex(*FoundIndex)) ? NodeLinks[*FoundIndex].BqCategoryIndex : INDEX_NONE;
+}
+
+bool FLECategoryTreeCore::BindBqCategoryIndices(const TArray<FString>& BqCategoryNames)
+{
+	FScopeLock Lock(&TreeLock);
+
+	// 清除旧的绑定
+	for (FLECategoryNodeLinks& Links : NodeLinks)
+	{
+		Links.BqCategoryIndex = INDEX_NONE;
+	}
+	BqIndexToNodeIndex.Init(INDEX_NONE, BqCategoryNames.Num());
+
+	bool bSuccess = true;
+	for (int32 BqIndex = 0; BqIndex < BqCategoryNames.Num(); ++BqIndex)
+	{
+		// 索引 0 是 BqLog 的默认（空）分类，映射到根节点
+		const FString& CategoryName = BqCategoryNames[BqIndex];
+		const int32 NodeIndex = CategoryName.IsEmpty() ? RootNodeIndex : FindOrCreateNode(CategoryName);
+		if (!IsValidNodeIndex(NodeIndex))
+		{
+			LE_SYSTEM_WARNING(TEXT("Failed to bind BqLog category index %d: %s"), BqIndex, *CategoryName);
+			bSuccess = false;
+			continue;
+		}
+
+		BqIndexToNodeIndex[BqIndex] = NodeIndex;
+		NodeLinks[NodeIndex].BqCategoryIndex = BqIndex;
+	}
+
+	IncrementVersion();
+	LE_SYSTEM_LOG(TEXT("Bound %d BqLog category indices, success: %s"),
+		BqIndexToNodeIndex.Num(), bSuccess ? TEXT("true") : TEXT("false"));
+
+	return bSuccess;
+}
+
+bool FLECategoryTreeCore::SetCategoryEnabled(const FString& CategoryPath, bool bEnabled, bool bPropagate)
+{
+	FScopeLock Lock(&TreeLock);
+
+	int32 NodeIndex = FindNodeIndex(CategoryPath);
+	if (NodeIndex == INDEX_NONE)
+	{
+		NodeIndex = FindOrCreateNode(CategoryPath);
+		if (NodeIndex == INDEX_NONE)
+		{
+			return false;
+		}
+	}
+
+	NodeIndex = EnsurePreOrderLayout(NodeIndex);
+	if (!IsValidNodeIndex(NodeIndex))
+	{
+		return false;
+	}
+
+	// 设置节点自身的启用开关；不传播时子节点保留各自的开关，禁用通过有效启用状态继承，重新启用即可完全恢复
+	const int32 SubtreeEnd = NodeLinks[NodeIndex].SubtreeEnd;
+	EnabledFlags[NodeIndex] = bEnabled;
+	ClearRuleFlags(NodeIndex, bPropagate ? SubtreeEnd : NodeIndex + 1, RuleFlagDisabled);
+
+	// 强制传播：覆盖所有子节点自身的开关
+	if (bPropagate)
+	{
+		UpdateChildrenEnabledState(NodeIndex, bEnabled);
+	}
+
+	// 对子树区间做一次线性扫描，更新有效启用状态与过滤字节
+	ResolveEffectiveState(NodeIndex, SubtreeEnd);
+
+	IncrementVersion();
+	LE_SYSTEM_LOG(TEXT("Set category enabled: %s = %s (propagate: %s)"),
+		*CategoryPath, bEnabled ? TEXT("true") : TEXT("false"), bPropagate ? TEXT("true") : TEXT("false"));
+
+	return true;
+}
+
+bool FLECategoryTreeCore::IsCategoryEnabled(const FString& CategoryPath) const
+{
+	FScopeLock Lock(&TreeLock);
+
+	int32 NodeIndex = FindNodeIndex(CategoryPath);
+	if (IsValidNodeIndex(NodeIndex))
+	{
+		return EffectiveEnabledFlags[NodeIndex];
+	}
+
+	// 默认启用
+	return true;
+}
+
+TArray<FString> FLECategoryTreeCore::GetAllCategoryPaths() const
+{
+	FScopeLock Lock(&TreeLock);
+
+	TArray<FString> Paths;
+	Paths.Reserve(NodeLinks.Num());
+
+	for (int32 NodeIndex = 0; NodeIndex < NodeLinks.Num(); ++NodeIndex)
+	{
+		if (NodeLinks[NodeIndex].ParentIndex != INDEX_NONE) // 跳过根节点
+		{
+			Paths.Add(FullNames[NodeIndex].ToString());
+		}
+	}
+
+	return Paths;
+}
+
+TArray<FString> FLECategoryTreeCore::GetChildCategories(const FString& CategoryPath) const
+{
+	FScopeLock Lock(&TreeLock);
+
+	TArray<FString> ChildPaths;
+	int32 NodeIndex = FindNodeIndex(CategoryPath);
+
+	if (IsValidNodeIndex(NodeIndex))
+	{
+		for (int32 ChildIndex = NodeLinks[NodeIndex].FirstChildIndex; IsValidNodeIndex(ChildIndex);
+			ChildIndex = NodeLinks[ChildIndex].NextSiblingIndex)
+		{
+			ChildPaths.Add(FullNames[ChildIndex].ToString());
+		}
+	}
+
+	return ChildPaths;
+}
+
+bool FLECategoryTreeCore::GetCategoryNode(const FString& CategoryPath, FLECategoryNode& OutNode) const
+{
+	FScopeLock Lock(&TreeLock);
+
+	const int32 NodeIndex = FindNodeIndex(CategoryPath);
+	if (!IsValidNodeIndex(NodeIndex))
+	{
+		return false;
+	}
+
+	OutNode = MakeNodeView(NodeIndex);
+	return true;
+}
+
+TArray<FLECategoryNode> FLECategoryTreeCore::GetAllCategoryNodes() const
+{
+	FScopeLock Lock(&TreeLock);
+
+	TArray<FLECategoryNode> NodeViews;
+	NodeViews.Reserve(NodeLinks.Num());
+
+	for (int32 NodeIndex = 0; NodeIndex < NodeLinks.Num(); ++NodeIndex)
+	{
+		NodeViews.Add(MakeNodeView(NodeIndex));
+	}
+
+	return NodeViews;
+}
+
+void FLECategoryTreeCore::ResetToDefault()
+{
+	FScopeLock Lock(&TreeLock);
+
+	// 重置所有节点到默认状态
+	const int32 NumNodes = NodeLinks.Num();
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		HasExplicitLevelFlags[NodeIndex] = false;
+		ExplicitLevels[NodeIndex] = ELELogVerbosity::NoLogging;
+		EffectiveLevels[NodeIndex] = ELELogVerbosity::Info;
+		EnabledFlags[NodeIndex] = true;
+		EffectiveEnabledFlags[NodeIndex] = true;
+		RuleFlags[NodeIndex] = 0;
+	}
+	RefreshNodeFilterBytes(0, NumNodes);
+
+	// 重新计算所有有效级别
+	EnsurePreOrderLayout();
+	if (IsValidNodeIndex(RootNodeIndex))
+	{
+		UpdateChildrenEffectiveLevels(RootNodeIndex, ELELogVerbosity::Info, true);
+	}
+
+	// 分类规则属于配置而非运行时修改，重置后重新套用
+	if (CategoryRules.Num() > 0)
+	{
+		CompileCategoryRules();
+	}
+
+	IncrementVersion();
+	LE_SYSTEM_LOG(TEXT("Category tree reset to default"));
+}
+
+void FLECategoryTreeCore::GetTreeStatistics(int32& OutTotalNodes, int32& OutMaxDepth, int32& OutExplicitNodes) const
+{
+	FScopeLock Lock(&TreeLock);
+
+	OutTotalNodes = NodeLinks.Num();
+	OutMaxDepth = 0;
+	OutExplicitNodes = 0;
+
+	for (const FLECategoryNodeLinks& Links : NodeLinks)
+	{
+		if (Links.Depth > OutMaxDepth)
+		{
+			OutMaxDepth = Links.Depth;
+		}
+	}
+
+	for (bool bHasExplicitLevel : HasExplicitLevelFlags)
+	{
+		if (bHasExplicitLevel)
+		{
+			OutExplicitNodes++;
+		}
+	}
+}
+
+FString FLECategoryTreeCore::ExportTreeDebugString() const
+{
+	FScopeLock Lock(&TreeLock);
+
+	FString DebugString = FString::Printf(TEXT("=== Category Tree Debug Info (Version: %d) ===\n"), TreeVersion);
+	DebugString += FString::Printf(TEXT("Total Nodes: %d, Root Index: %d\n\n"), NodeLinks.Num(), RootNodeIndex);
+
+	if (IsValidNodeIndex(RootNodeIndex))
+	{
+		CollectDebugInfo(RootNodeIndex, 0, DebugString);
+	}
+
+	return DebugString;
+}
+
+void FLECategoryTreeCore::CreateRootNode()
+{
+	const FName RootName(TEXT("LogRoot"));
+	RootNodeIndex = AddNode(RootName, RootName, INDEX_NONE, ELELogVerbosity::Info);
+	ExplicitLevels[RootNodeIndex] = ELELogVerbosity::Info;
+	HasExplicitLevelFlags[RootNodeIndex] = true;
+	PathToIndexMap.Add(RootName, RootNodeIndex);
+}
+
+int32 FLECategoryTreeCore::AddNode(FName SubName, FName FullName, int32 ParentIndex, ELELogVerbosity InheritedLevel)
+{
+	const int32 NodeIndex = NodeLinks.AddDefaulted();
+	NodeFilterBytes.Add(static_cast<uint8>(InheritedLevel));
+	EffectiveLevels.Add(InheritedLevel);
+	EnabledFlags.Add(true);
+	EffectiveEnabledFlags.Add(true);
+	ExplicitLevels.Add(ELELogVerbosity::NoLogging);
+	HasExplicitLevelFlags.Add(false);
+	RuleFlags.Add(0);
+	FullNames.Add(FullName);
+	SubNames.Add(SubName);
+
+	FLECategoryNodeLinks& Links = NodeLinks[NodeIndex];
+	Links.ParentIndex = ParentIndex;
+	Links.SubtreeEnd = NodeIndex + 1;
+
+	if (IsValidNodeIndex(ParentIndex))
+	{
+		ChildLookup.Add(FLECategoryChildKey{ ParentIndex, SubName }, NodeIndex);
+
+		// 链接到父节点子链表末尾，保持兄弟间的插入顺序
+		FLECategoryNodeLinks& ParentLinks = NodeLinks[ParentIndex];
+		Links.Depth = ParentLinks.Depth + 1;
+		if (ParentLinks.LastChildIndex != INDEX_NONE)
+		{
+			NodeLinks[ParentLinks.LastChildIndex].NextSiblingIndex = NodeIndex;
+		}
+		else
+		{
+			ParentLinks.FirstChildIndex = NodeIndex;
+		}
+		ParentLinks.LastChildIndex = NodeIndex;
+
+		// 新节点继承父节点的有效启用状态
+		EffectiveEnabledFlags[NodeIndex] = EffectiveEnabledFlags[ParentIndex];
+
+		// 新分类出现时套用已设置的分类规则（新节点是叶子，只影响它自己）
+		if (CategoryRules.Num() > 0 && ApplyRulesToNode(NodeIndex))
+		{
+			EffectiveLevels[NodeIndex] = HasExplicitLevelFlags[NodeIndex] ? ExplicitLevels[NodeIndex] : InheritedLevel;
+			EffectiveEnabledFlags[NodeIndex] = EffectiveEnabledFlags[NodeIndex] && EnabledFlags[NodeIndex];
+		}
+		RefreshNodeFilterBytes(NodeIndex, NodeIndex + 1);
+	}
+
+	// 追加到末尾破坏了前序布局（第一个节点除外），推迟到下次传播/刷新时统一重排
+	if (NodeIndex != 0)
+	{
+		bLayoutDirty = true;
+	}
+
+	return NodeIndex;
+}
+
+FLECategoryNode FLECategoryTreeCore::MakeNodeView(int32 NodeIndex) const
+{
+	FLECategoryNode Node;
+	if (!IsValidNodeIndex(NodeIndex))
+	{
+		return Node;
+	}
+
+	const FLECategoryNodeLinks& Links = NodeLinks[NodeIndex];
+	Node.CategorySubName = SubNames[NodeIndex];
+	Node.CategoryFullName = FullNames[NodeIndex];
+	Node.ExplicitLevel = ExplicitLevels[NodeIndex];
+	Node.EffectiveLevel = EffectiveLevels[NodeIndex];
+	Node.bHasExplicitLevel = HasExplicitLevelFlags[NodeIndex];
+	Node.bIsEnabled = EnabledFlags[NodeIndex];
+	Node.bIsEffectivelyEnabled = EffectiveEnabledFlags[NodeIndex];
+	Node.ParentIndex = Links.ParentIndex;
+	Node.Depth = Links.Depth;
+	Node.SubtreeEnd = Links.SubtreeEnd;
+	Node.BqCategoryIndex = Links.BqCategoryIndex;
+
+	for (int32 ChildIndex = Links.FirstChildIndex; IsValidNodeIndex(ChildIndex); ChildIndex = NodeLinks[ChildIndex].NextSiblingIndex)
+	{
+		Node.ChildIndices.Add(ChildIndex);
+	}
+
+	return Node;
+}
+
+void FLECategoryTreeCore::RefreshNodeFilterBytes(int32 Begin, int32 End)
+{
+	// 无分支的线性扫描，编译器可向量化
+	uint8* FilterData = NodeFilterBytes.GetData();
+	const ELELogVerbosity* LevelData = EffectiveLevels.GetData();
+	const bool* EnabledData = EffectiveEnabledFlags.GetData();
+	for (int32 Index = Begin; Index < End; ++Index)
+	{
+		const uint8 DisabledMask = static_cast<uint8>(0) - static_cast<uint8>(!EnabledData[Index]);
+		FilterData[Index] = static_cast<uint8>(LevelData[Index]) | DisabledMask;
+	}
+}
+
+int32 FLECategoryTreeCore::FindOrCreateNode(FStringView CategoryPath)
+{
+	// 检查节点是否已存在（完整路径一次查找）
+	const int32 ExistingIndex = FindNodeIndex(CategoryPath);
+	if (ExistingIndex != INDEX_NONE)
+	{
+		return ExistingIndex;
+	}
+
+	// 移除 LogRoot 前缀（如果存在）
+	const FStringView RootPrefix = TEXTVIEW("LogRoot.");
+	if (CategoryPath.StartsWith(RootPrefix))
+	{
+		CategoryPath.RightChopInline(RootPrefix.Len());
+	}
+
+	if (CategoryPath.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	// 空组件（首尾或连续的点）很少见：规范化后再处理，与按点分割并丢弃空段的行为一致
+	if (CategoryPath.StartsWith(TEXT('.')) || CategoryPath.EndsWith(TEXT('.')) || CategoryPath.Contains(TEXTVIEW("..")))
+	{
+		TStringBuilder<256> NormalizedPath;
+		UE::String::ParseTokens(CategoryPath, TEXT('.'), [&NormalizedPath](FStringView Component)
+		{
+			if (NormalizedPath.Len() > 0)
+			{
+				NormalizedPath << TEXT('.');
+			}
+			NormalizedPath << Component;
+		}, UE::String::EParseTokensOptions::SkipEmpty);
+
+		return NormalizedPath.Len() > 0 ? FindOrCreateNode(NormalizedPath.ToView()) : INDEX_NONE;
+	}
+
+	// 确保根节点存在
+	if (!IsValidNodeIndex(RootNodeIndex))
+	{
+		CreateRootNode();
+	}
+
+	// 逐级查找或创建：每个组件只哈希一次，按（父节点, 子名称）查找，路径前缀是原字符串的切片，不分配临时字符串
+	int32 CurrentParentIndex = RootNodeIndex;
+	int32 ComponentStart = 0;
+	while (ComponentStart <= CategoryPath.Len())
+	{
+		int32 ComponentEnd = INDEX_NONE;
+		if (CategoryPath.RightChop(ComponentStart).FindChar(TEXT('.'), ComponentEnd))
+		{
+			ComponentEnd += ComponentStart;
+		}
+		else
+		{
+			ComponentEnd = CategoryPath.Len();
+		}
+
+		const FName SubName(ComponentEnd - ComponentStart, CategoryPath.GetData() + ComponentStart);
+		const int32* ChildIndex = ChildLookup.Find(FLECategoryChildKey{ CurrentParentIndex, SubName });
+		if (ChildIndex)
+		{
+			CurrentParentIndex = *ChildIndex;
+		}
+		else
+		{
+			// 创建新节点（深度由父节点推出），继承父节点的有效级别
+			const FName FullName(ComponentEnd, CategoryPath.GetData());
+			const int32 NodeIndex = AddNode(SubName, FullName, CurrentParentIndex, EffectiveLevels[CurrentParentIndex]);
+			PathToIndexMap.Add(FullName, NodeIndex);
+			CurrentParentIndex = NodeIndex;
+		}
+
+		ComponentStart = ComponentEnd + 1;
+	}
+
+	return CurrentParentIndex;
+}
+
+int32 FLECategoryTreeCore::FindNodeIndex(FStringView CategoryPath) const
+{
+	// FNAME_Find 不会向名称表注册新名称：名称不存在时路径必然不在树中
+	const FName PathName(CategoryPath.Len(), CategoryPath.GetData(), FNAME_Find);
+	if (PathName.IsNone())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32* FoundIndex = PathToIndexMap.Find(PathName);
+	return FoundIndex ? *FoundIndex : INDEX_NONE;
+}
+
+int32 FLECategoryTreeCore::EnsurePreOrderLayout(int32 TrackedIndex, TArrayView<int32> TrackedIndices)
+{
+	if (!bLayoutDirty)
+	{
+		return TrackedIndex;
+	}
+	bLayoutDirty = false;
+
+	if (!IsValidNodeIndex(RootNodeIndex))
+	{
+		return TrackedIndex;
+	}
+
+	const int32 NumNodes = NodeLinks.Num();
+	TArray<int32> OldToNew;
+	OldToNew.Init(INDEX_NONE, NumNodes);
+	TArray<int32> NewToOld;
+	NewToOld.Reserve(NumNodes);
+
+	// 显式栈的深度优先遍历：先压入下一兄弟再压入首子，保证子树先于兄弟输出
+	TArray<int32, TInlineAllocator<64>> Stack;
+	Stack.Push(RootNodeIndex);
+	while (Stack.Num() > 0)
+	{
+		const int32 OldIndex = Stack.Pop();
+		OldToNew[OldIndex] = NewToOld.Add(OldIndex);
+
+		const FLECategoryNodeLinks& Links = NodeLinks[OldIndex];
+		if (OldIndex != RootNodeIndex && Links.NextSiblingIndex != INDEX_NONE)
+		{
+			Stack.Push(Links.NextSiblingIndex);
+		}
+		if (Links.FirstChildIndex != INDEX_NONE)
+		{
+			Stack.Push(Links.FirstChildIndex);
+		}
+	}
+
+	// 理论上不存在脱离根节点的节点；保险起见追加到末尾，避免索引悬空
+	for (int32 OldIndex = 0; OldIndex < NumNodes; ++OldIndex)
+	{
+		if (OldToNew[OldIndex] == INDEX_NONE)
+		{
+			OldToNew[OldIndex] = NewToOld.Add(OldIndex);
+		}
+	}
+
+	PermuteNodeArray(NodeFilterBytes, NewToOld);
+	PermuteNodeArray(EffectiveLevels, NewToOld);
+	PermuteNodeArray(EnabledFlags, NewToOld);
+	PermuteNodeArray(EffectiveEnabledFlags, NewToOld);
+	PermuteNodeArray(ExplicitLevels, NewToOld);
+	PermuteNodeArray(HasExplicitLevelFlags, NewToOld);
+	PermuteNodeArray(RuleFlags, NewToOld);
+	PermuteNodeArray(NodeLinks, NewToOld);
+	PermuteNodeArray(FullNames, NewToOld);
+	PermuteNodeArray(SubNames, NewToOld);
+
+	for (int32 NewIndex = 0; NewIndex < NumNodes; ++NewIndex)
+	{
+		FLECategoryNodeLinks& Links = NodeLinks[NewIndex];
+		Links.ParentIndex = RemapNodeIndex(Links.ParentIndex, OldToNew);
+		Links.FirstChildIndex = RemapNodeIndex(Links.FirstChildIndex, OldToNew);
+		Links.LastChildIndex = RemapNodeIndex(Links.LastChildIndex, OldToNew);
+		Links.NextSiblingIndex = RemapNodeIndex(Links.NextSiblingIndex, OldToNew);
+		Links.SubtreeEnd = NewIndex + 1;
+	}
+
+	// 逆序回填子树区间：前序中后代总是排在祖先之后
+	for (int32 Index = NumNodes - 1; Index >= 0; --Index)
+	{
+		const int32 ParentIndex = NodeLinks[Index].ParentIndex;
+		if (ParentIndex != INDEX_NONE)
+		{
+			NodeLinks[ParentIndex].SubtreeEnd = FMath::Max(NodeLinks[ParentIndex].SubtreeEnd, NodeLinks[Index].SubtreeEnd);
+		}
+	}
+
+	for (TPair<FName, int32>& Pair : PathToIndexMap)
+	{
+		Pair.Value = OldToNew[Pair.Value];
+	}
+
+	// 子节点查找表的键含父节点索引，直接按新布局重建
+	ChildLookup.Reset();
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		if (NodeLinks[NodeIndex].ParentIndex != INDEX_NONE)
+		{
+			ChildLookup.Add(FLECategoryChildKey{ NodeLinks[NodeIndex].ParentIndex, SubNames[NodeIndex] }, NodeIndex);
+		}
+	}
+
+	for (int32& NodeIndex : BqIndexToNodeIndex)
+	{
+		NodeIndex = RemapNodeIndex(NodeIndex, OldToNew);
+	}
+	RootNodeIndex = OldToNew[RootNodeIndex];
+	for (int32& NodeIndex : TrackedIndices)
+	{
+		NodeIndex = RemapNodeIndex(NodeIndex, OldToNew);
+	}
+
+	return (TrackedIndex >= 0 && TrackedIndex < NumNodes) ? OldToNew[TrackedIndex] : TrackedIndex;
+}
+
+void FLECategoryTreeCore::UpdateChildrenEffectiveLevels(int32 NodeIndex, ELELogVerbosity NewLevel, bool bForceOverride)
+{
+	if (!IsValidNodeIndex(NodeIndex))
+	{
+		return;
+	}
+	checkSlow(!bLayoutDirty);
+
+	const int32 SubtreeEnd = NodeLinks[NodeIndex].SubtreeEnd;
+	ELELogVerbosity* LevelData = EffectiveLevels.GetData();
+
+	if (bForceOverride)
+	{
+		// 强制覆盖模式：整个子树区间都设置为新的显式级别（连续区间填充）
+		const int32 Count = SubtreeEnd - (NodeIndex + 1);
+		for (int32 Index = NodeIndex + 1; Index < SubtreeEnd; ++Index)
+		{
+			LevelData[Index] = NewLevel;
+			ExplicitLevels[Index] = NewLevel;
+		}
+		FMemory::Memset(HasExplicitLevelFlags.GetData() + NodeIndex + 1, 1, Count * sizeof(bool));
+		RefreshNodeFilterBytes(NodeIndex + 1, SubtreeEnd);
+		return;
+	}
+
+	// 智能继承模式：仅更新没有显式设置的节点；显式节点的后代继承它自己的级别，整段跳过
+	const bool* HasExplicitData = HasExplicitLevelFlags.GetData();
+	for (int32 Index = NodeIndex + 1; Index < SubtreeEnd;)
+	{
+		if (HasExplicitData[Index])
+		{
+			Index = NodeLinks[Index].SubtreeEnd;
+			continue;
+		}
+
+		LevelData[Index] = NewLevel;
+		++Index;
+	}
+	RefreshNodeFilterBytes(NodeIndex + 1, SubtreeEnd);
+}
+
+void FLECategoryTreeCore::ResolveEffectiveState(int32 Begin, int32 End)
+{
+	checkSlow(!bLayoutDirty);
+
+	ELELogVerbosity* LevelData = EffectiveLevels.GetData();
+	bool* EffectiveEnabledData = EffectiveEnabledFlags.GetData();
+	const ELELogVerbosity* ExplicitData = ExplicitLevels.GetData();
+	const bool* HasExplicitData = HasExplicitLevelFlags.GetData();
+	const bool* EnabledData = EnabledFlags.GetData();
+	for (int32 Index = Begin; Index < End; ++Index)
+	{
+		const int32 ParentIndex = NodeLinks[Index].ParentIndex;
+		if (ParentIndex != INDEX_NONE)
+		{
+			LevelData[Index] = HasExplicitData[Index] ? ExplicitData[Index] : LevelData[ParentIndex];
+			EffectiveEnabledData[Index] = EnabledData[Index] && EffectiveEnabledData[ParentIndex];
+		}
+		else
+		{
+			LevelData[Index] = HasExplicitData[Index] ? ExplicitData[Index] : ELELogVerbosity::Info;
+			EffectiveEnabledData[Index] = EnabledData[Index];
+		}
+	}
+	RefreshNodeFilterBytes(Begin, End);
+}
+
+void FLECategoryTreeCore::UpdateChildrenEnabledState(int32 NodeIndex, bool bEnabled)
+{
+	if (!IsValidNodeIndex(NodeIndex))
+	{
+		return;
+	}
+	checkSlow(!bLayoutDirty);
+
+	const int32 SubtreeEnd = NodeLinks[NodeIndex].SubtreeEnd;
+	const int32 Count = SubtreeEnd - (NodeIndex + 1);
+	FMemory::Memset(EnabledFlags.GetData() + NodeIndex + 1, bEnabled ? 1 : 0, Count * sizeof(bool));
+}
+
+int32 FLECategoryTreeCore::CompileCategoryRules()
+{
+	checkSlow(!bLayoutDirty);
+
+	// 撤销上一组规则的效果：规则写入的显式级别恢复为继承，规则禁用的分类重新启用
+	const int32 NumNodes = NodeLinks.Num();
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		if (RuleFlags[NodeIndex] & RuleFlagLevel)
+		{
+			HasExplicitLevelFlags[NodeIndex] = false;
+			ExplicitLevels[NodeIndex] = ELELogVerbosity::NoLogging;
+		}
+		if (RuleFlags[NodeIndex] & RuleFlagDisabled)
+		{
+			EnabledFlags[NodeIndex] = true;
+		}
+		RuleFlags[NodeIndex] = 0;
+	}
+
+	int32 NumMatched = 0;
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		if (NodeLinks[NodeIndex].ParentIndex != INDEX_NONE && ApplyRulesToNode(NodeIndex))
+		{
+			++NumMatched;
+		}
+	}
+
+	ResolveEffectiveState(0, NumNodes);
+	return NumMatched;
+}
+
+bool FLECategoryTreeCore::ApplyRulesToNode(int32 NodeIndex)
+{
+	TStringBuilder<256> CategoryPath;
+	FullNames[NodeIndex].AppendString(CategoryPath);
+
+	// 规则按顺序求值，后匹配的规则覆盖先匹配的；级别规则同时取消之前的禁用
+	bool bMatched = false;
+	bool bHasLevel = false;
+	bool bDisabled = false;
+	ELELogVerbosity Level = ELELogVerbosity::Info;
+	for (const FLECategoryRule& Rule : CategoryRules)
+	{
+		if (!Rule.Matches(CategoryPath.ToView()))
+		{
+			continue;
+		}
+
+		bMatched = true;
+		if (Rule.bDisable)
+		{
+			bDisabled = true;
+		}
+		else
+		{
+			bHasLevel = true;
+			bDisabled = false;
+			Level = Rule.Level;
+		}
+	}
+
+	if (bHasLevel)
+	{
+		ExplicitLevels[NodeIndex] = Level;
+		HasExplicitLevelFlags[NodeIndex] = true;
+		RuleFlags[NodeIndex] |= RuleFlagLevel;
+	}
+	if (bDisabled)
+	{
+		EnabledFlags[NodeIndex] = false;
+		RuleFlags[NodeIndex] |= RuleFlagDisabled;
+	}
+
+	return bMatched;
+}
+
+void FLECategoryTreeCore::ClearRuleFlags(int32 Begin, int32 End, uint8 Mask)
+{
+	for (int32 NodeIndex = Begin; NodeIndex < End; ++NodeIndex)
+	{
+		RuleFlags[NodeIndex] &= ~Mask;
+	}
+}
+
+void FLECategoryTreeCore::RefreshCategoryFilterTable()
+{
+	// 批量插入后在这里统一重排，保证发布后的树始终满足前序布局
+	EnsurePreOrderLayout();
+
+	const int32 NumBqCategories = BqIndexToNodeIndex.Num();
+	if (NumBqCategories == 0)
+	{
+		PublishFilterSnapshot(nullptr);
+		FLEFilterState::PublishFromTree(this, nullptr);
+		LogEverything::InvalidateCallSites();
+		return;
+	}
+
+	// 构建新的不可变快照，读者在发布前看不到它
+	FLECategoryFilterSnapshot* NewSnapshot = new FLECategoryFilterSnapshot();
+	NewSnapshot->TreeVersion = TreeVersion;
+	NewSnapshot->FilterBytes.SetNumUninitialized(NumBqCategories);
+
+	uint8* FilterData = NewSnapshot->FilterBytes.GetData();
+	for (int32 BqIndex = 0; BqIndex < NumBqCategories; ++BqIndex)
+	{
+		const int32 NodeIndex = BqIndexToNodeIndex[BqIndex];
+		FilterData[BqIndex] = IsValidNodeIndex(NodeIndex)
+			? NodeFilterBytes[NodeIndex]
+			: static_cast<uint8>(ELELogVerbosity::Warning);
+	}
+
+	PublishFilterSnapshot(NewSnapshot);
+
+	// 活动分类树：同步到进程级过滤状态，原生过滤模式下再编译进 BqLog
+	if (FLEFilterState::IsActiveTree(this))
+	{
+		FLEFilterState::PublishFromTree(this, NewSnapshot);
+
+		FLEBqLogBridge& Bridge = FLEBqLogBridge::Get();
+		if (Bridge.IsNativeFilteringEnabled())
+		{
+			FLENativeCategoryFilter NativeFilter;
+			BuildNativeCategoryFilter(NativeFilter);
+			Bridge.ApplyNativeCategoryFilter(NativeFilter);
+		}
+	}
+
+	// 过滤表已变化，使所有调用点缓存失效
+	LogEverything::InvalidateCallSites();
+}
+
+void FLECategoryTreeCore::PublishFilterSnapshot(const FLECategoryFilterSnapshot* NewSnapshot)
+{
+	const FLECategoryFilterSnapshot* OldSnapshot = FilterSnapshot.exchange(NewSnapshot, std::memory_order_seq_cst);
+	FLEEpochReclaimer::Retire(OldSnapshot);
+}
+
+FLECategoryFilterSnapshot* FLECategoryTreeCore::CopyFilterSnapshot() const
+{
+	const FLECategoryFilterSnapshot* Snapshot = FilterSnapshot.load(std::memory_order_acquire);
+	return Snapshot ? new FLECategoryFilterSnapshot(*Snapshot) : nullptr;
+}
+
+void FLECategoryTreeCore::BuildNativeCategoryFilter(FLENativeCategoryFilter& OutFilter) const
+{
+	FScopeLock Lock(&TreeLock);
+
+	// 写者线程读取自己发布的快照：只有写者会退休快照，无需读区保护
+	const FLECategoryFilterSnapshot* Snapshot = FilterSnapshot.load(std::memory_order_acquire);
+	const int32 NumBqCategories = Snapshot ? FMath::Min(BqIndexToNodeIndex.Num(), Snapshot->FilterBytes.Num()) : 0;
+	OutFilter.FilterBytes.SetNumUninitialized(NumBqCategories);
+	OutFilter.ParentIndices.SetNumUninitialized(NumBqCategories);
+
+	if (NumBqCategories > 0)
+	{
+		FMemory::Memcpy(OutFilter.FilterBytes.GetData(), Snapshot->FilterBytes.GetData(), NumBqCategories);
+	}
+
+	for (int32 BqIndex = 0; BqIndex < NumBqCategories; ++BqIndex)
+	{
+		int32 ParentBqIndex = INDEX_NONE;
+		const int32 NodeIndex = BqIndexToNodeIndex[BqIndex];
+		if (BqIndex > 0 && IsValidNodeIndex(NodeIndex))
+		{
+			// 向上找到第一个绑定了 BqLog 索引的祖先，找不到时归到根分类
+			ParentBqIndex = 0;
+			for (int32 ParentNodeIndex = NodeLinks[NodeIndex].ParentIndex; IsValidNodeIndex(ParentNodeIndex);
+				ParentNodeIndex = NodeLinks[ParentNodeIndex].ParentIndex)
+			{
+				if (NodeLinks[ParentNodeIndex].BqCategoryIndex != INDEX_NONE)
+				{
+					ParentBqIndex = NodeLinks[ParentNodeIndex].BqCategoryIndex;
+					break;
+				}
+			}
+		}
+		OutFilter.ParentIndices[BqIndex] = ParentBqIndex;
+	}
+}
+
+bool FLECategoryTreeCore::IsValidNodeIndex(int32 NodeIndex) const
+{
+	return NodeIndex >= 0 && NodeIndex < NodeLinks.Num();
+}
+
+void FLECategoryTreeCore::CollectDebugInfo(int32 NodeIndex, int32 Depth, FString& OutString) const
+{
+	if (!IsValidNodeIndex(NodeIndex))
+	{
+		return;
+	}
+
+	const FLECategoryNode Node = MakeNodeView(NodeIndex);
+
+	// 添加缩进
+	FString Indent = TEXT("");
+	for (int32 i = 0; i < Depth; ++i)
+	{
+		Indent += TEXT("  ");
+	}
+
+	// 添加节点信息
+	OutString += FString::Printf(TEXT("%s[%d] %s\n"), *Indent, NodeIndex, *Node.GetDebugString());
+
+	// 递归添加子节点信息
+	for (int32 ChildIndex = NodeLinks[NodeIndex].FirstChildIndex; IsValidNodeIndex(ChildIndex);
+		ChildIndex = NodeLinks[ChildIndex].NextSiblingIndex)
+	{
+		CollectDebugInfo(ChildIndex, Depth + 1, OutString);
+	}
+}
\ No newline at end of file
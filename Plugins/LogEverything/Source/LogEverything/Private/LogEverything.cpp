@@ -3,6 +3,8 @@
 #include "LogEverything.h"
 #include "Bridge/LEBqLogBridge.h"
 #include "System/LELogTypes.h"
+#include "System/LELogCallSite.h"
+#include "System/LEFilterState.h"
 #include "Utils/LogEverythingUtils.h"
 
 #define LOCTEXT_NAMESPACE "FLogEverythingModule"
@@ -10,11 +12,16 @@
 // 定义日志系统自身的日志分类
 DEFINE_LOG_CATEGORY(LogEverythingPlugin);
 
+// 调用点纪元从 1 开始，零初始化的调用点记录首次执行时必然重新计算
+std::atomic<uint32> LogEverything::GCallSiteEpoch{ 1 };
+
 void FLogEverythingModule::StartupModule()
 {
 	// 初始化 LogEverything 系统
 	LE_SYSTEM_LOG(TEXT("LogEverything module starting up..."));
-	
+
+	// 进程级过滤状态：从模块加载起即可过滤早期启动、Commandlet 与服务器启动日志
+	FLEFilterState::Startup();
 }
 
 void FLogEverythingModule::ShutdownModule()
@@ -22,6 +29,9 @@ void FLogEverythingModule::ShutdownModule()
 	// 关闭 LogEverything 系统
 	LE_SYSTEM_LOG(TEXT("LogEverything module shutting down..."));
 
+	FLEFilterState::Shutdown();
+	FLEEpochReclaimer::Reclaim();
+
 	LE_SYSTEM_LOG(TEXT("LogEverything module shutdown complete"));
 }
 
@@ -0,0 +1,257 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "System/LEDecisionTracer.h"
+#include "Utils/LogEverythingUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+std::atomic<bool> FLEDecisionTracer::bEnabled{ false };
+std::atomic<uint32> FLEDecisionTracer::SampleInterval{ 1 };
+
+namespace LogEverything
+{
+	namespace Private
+	{
+		/**
+		 * 每线程决策环形缓冲
+		 * 每项打包为一个 64 位原子量：[Cycles:32][CategoryIndex:22][Level:8][Decision:1]，
+		 * 转储线程可以在不加锁的情况下读取到完整的条目
+		 */
+		struct FLEDecisionRing
+		{
+			std::atomic<uint64> Entries[FLEDecisionTracer::RingCapacity];
+			std::atomic<uint32> WriteIndex{ 0 };
+			uint32 SampleCounter = 0;
+			uint32 ThreadId = 0;
+
+			FLEDecisionRing()
+			{
+				for (std::atomic<uint64>& Entry : Entries)
+				{
+					Entry.store(0, std::memory_order_relaxed);
+				}
+			}
+		};
+
+		/** 按分类 × 级别 × 决策聚合的计数 */
+		static std::atomic<uint32> DecisionCounters[FLEDecisionTracer::MaxTracedCategories][FLEDecisionTracer::NumTracedLevels][2];
+
+		/** 已注册的线程环形缓冲（仅在线程首次记录、线程退出与转储时加锁） */
+		static FCriticalSection& GetRingRegistryLock()
+		{
+			static FCriticalSection RegistryLock;
+			return RegistryLock;
+		}
+
+		static TArray<FLEDecisionRing*>& GetRingRegistry()
+		{
+			static TArray<FLEDecisionRing*> Registry;
+			return Registry;
+		}
+
+		/** 线程本地句柄：首次记录时注册环形缓冲，线程退出时注销并释放 */
+		struct FLEDecisionRingHandle
+		{
+			FLEDecisionRing* Ring = nullptr;
+
+			FLEDecisionRing& GetOrRegister()
+			{
+				if (!Ring)
+				{
+					Ring = new FLEDecisionRing();
+					Ring->ThreadId = FPlatformTLS::GetCurrentThreadId();
+
+					FScopeLock Lock(&GetRingRegistryLock());
+					GetRingRegistry().Add(Ring);
+				}
+				return *Ring;
+			}
+
+			~FLEDecisionRingHandle()
+			{
+				if (!Ring)
+				{
+					return;
+				}
+
+				// 转储与重置只在锁内访问缓冲，注销后即可释放
+				FScopeLock Lock(&GetRingRegistryLock());
+				GetRingRegistry().RemoveSwap(Ring);
+				delete Ring;
+			}
+		};
+
+		static FLEDecisionRing& GetThreadRing()
+		{
+			static thread_local FLEDecisionRingHandle ThreadHandle;
+			return ThreadHandle.GetOrRegister();
+		}
+
+		static constexpr uint64 EntryValidBit = 1ull << 31;
+
+		FORCEINLINE static uint64 PackEntry(uint32 Cycles, int32 CategoryIndex, ELELogVerbosity Level, bool bDecision)
+		{
+			return (static_cast<uint64>(Cycles) << 32)
+				| EntryValidBit
+				| (static_cast<uint64>(static_cast<uint32>(CategoryIndex) & 0x3FFFFFu) << 9)
+				| (static_cast<uint64>(static_cast<uint8>(Level)) << 1)
+				| (bDecision ? 1ull : 0ull);
+		}
+
+		static void OnDebugLogCategoryChanged(IConsoleVariable* Variable)
+		{
+			FLEDecisionTracer::SetEnabled(Variable->GetBool());
+		}
+
+		static void OnTraceSampleIntervalChanged(IConsoleVariable* Variable)
+		{
+			FLEDecisionTracer::SetSampleInterval(Variable->GetInt());
+		}
+	}
+
+	namespace ConsoleVariable
+	{
+		/** Controls whether filtering decisions are traced; the sink only flips the tracer's atomic flag */
+		static TAutoConsoleVariable<bool> DebugLogCategory(
+			TEXT("LogEverything.Debug.LogCategory"),
+			false,
+			TEXT("Controls whether LogEverything traces category filtering decisions\n")
+			TEXT("0: Disable decision tracing (default)\n")
+			TEXT("1: Enable decision tracing (dump with LE.Debug.DumpDecisionTrace)"),
+			FConsoleVariableDelegate::CreateStatic(&Private::OnDebugLogCategoryChanged),
+			ECVF_Default
+		);
+
+		/** Controls how many decisions are skipped between ring buffer samples */
+		static TAutoConsoleVariable<int32> TraceSampleInterval(
+			TEXT("LogEverything.Debug.TraceSampleInterval"),
+			1,
+			TEXT("Record one of every N filtering decisions into the per-thread trace ring (aggregated counters are unaffected)"),
+			FConsoleVariableDelegate::CreateStatic(&Private::OnTraceSampleIntervalChanged),
+			ECVF_Default
+		);
+	}
+}
+
+void FLEDecisionTracer::SetEnabled(bool bInEnabled)
+{
+	bEnabled.store(bInEnabled, std::memory_order_relaxed);
+}
+
+void FLEDecisionTracer::SetSampleInterval(int32 InSampleInterval)
+{
+	SampleInterval.store(static_cast<uint32>(FMath::Max(1, InSampleInterval)), std::memory_order_relaxed);
+}
+
+void FLEDecisionTracer::Record(int32 CategoryIndex, ELELogVerbosity Level, bool bDecision)
+{
+	using namespace LogEverything::Private;
+
+	const uint32 LevelIndex = static_cast<uint32>(Level);
+	if (CategoryIndex >= 0 && static_cast<uint32>(CategoryIndex) < MaxTracedCategories && LevelIndex < NumTracedLevels)
+	{
+		DecisionCounters[CategoryIndex][LevelIndex][bDecision ? 1 : 0].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	FLEDecisionRing& Ring = GetThreadRing();
+	if (++Ring.SampleCounter < SampleInterval.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+	Ring.SampleCounter = 0;
+
+	// 只有所属线程写入，转储线程只读
+	const uint32 Slot = Ring.WriteIndex.load(std::memory_order_relaxed);
+	Ring.Entries[Slot & (RingCapacity - 1)].store(PackEntry(FPlatformTime::Cycles(), CategoryIndex, Level, bDecision), std::memory_order_relaxed);
+	Ring.WriteIndex.store(Slot + 1, std::memory_order_release);
+}
+
+void FLEDecisionTracer::Reset()
+{
+	using namespace LogEverything::Private;
+
+	for (auto& CategoryCounters : DecisionCounters)
+	{
+		for (auto& LevelCounters : CategoryCounters)
+		{
+			LevelCounters[0].store(0, std::memory_order_relaxed);
+			LevelCounters[1].store(0, std::memory_order_relaxed);
+		}
+	}
+
+	FScopeLock Lock(&GetRingRegistryLock());
+	for (FLEDecisionRing* Ring : GetRingRegistry())
+	{
+		for (std::atomic<uint64>& Entry : Ring->Entries)
+		{
+			Entry.store(0, std::memory_order_relaxed);
+		}
+	}
+}
+
+FString FLEDecisionTracer::ExportDebugString(int32 MaxRecentPerThread)
+{
+	using namespace LogEverything::Private;
+
+	FString Result = FString::Printf(TEXT("=== LogEverything Decision Trace (%s, sample 1/%u) ===\n"),
+		IsEnabled() ? TEXT("enabled") : TEXT("disabled"), SampleInterval.load(std::memory_order_relaxed));
+
+	// 聚合计数
+	Result += TEXT("Per-category decisions (allowed/filtered):\n");
+	for (uint32 CategoryIndex = 0; CategoryIndex < MaxTracedCategories; ++CategoryIndex)
+	{
+		FString Line;
+		for (uint32 LevelIndex = 0; LevelIndex < NumTracedLevels; ++LevelIndex)
+		{
+			const uint32 Filtered = DecisionCounters[CategoryIndex][LevelIndex][0].load(std::memory_order_relaxed);
+			const uint32 Allowed = DecisionCounters[CategoryIndex][LevelIndex][1].load(std::memory_order_relaxed);
+			if (Filtered + Allowed > 0)
+			{
+				Line += FString::Printf(TEXT(" %s=%u/%u"),
+					LELogVerbosityUtils::ToString(static_cast<ELELogVerbosity>(LevelIndex)), Allowed, Filtered);
+			}
+		}
+		if (!Line.IsEmpty())
+		{
+			Result += FString::Printf(TEXT("  [%u]%s\n"), CategoryIndex, *Line);
+		}
+	}
+
+	// 各线程最近的采样决策
+	const double MillisecondsPerCycle = FPlatformTime::GetSecondsPerCycle() * 1000.0;
+	const uint32 NowCycles = FPlatformTime::Cycles();
+
+	FScopeLock Lock(&GetRingRegistryLock());
+	for (const FLEDecisionRing* Ring : GetRingRegistry())
+	{
+		const uint32 WriteIndex = Ring->WriteIndex.load(std::memory_order_acquire);
+		const uint32 NumEntries = FMath::Min<uint32>(FMath::Min<uint32>(WriteIndex, RingCapacity), static_cast<uint32>(FMath::Max(0, MaxRecentPerThread)));
+		if (NumEntries == 0)
+		{
+			continue;
+		}
+
+		Result += FString::Printf(TEXT("Thread %u (%u sampled):\n"), Ring->ThreadId, WriteIndex);
+		for (uint32 Offset = 1; Offset <= NumEntries; ++Offset)
+		{
+			const uint64 Entry = Ring->Entries[(WriteIndex - Offset) & (RingCapacity - 1)].load(std::memory_order_relaxed);
+			if ((Entry & EntryValidBit) == 0)
+			{
+				continue;
+			}
+
+			const uint32 Cycles = static_cast<uint32>(Entry >> 32);
+			const uint32 CategoryIndex = static_cast<uint32>(Entry >> 9) & 0x3FFFFFu;
+			const ELELogVerbosity Level = static_cast<ELELogVerbosity>((Entry >> 1) & 0xFFu);
+			Result += FString::Printf(TEXT("  -%.3fms cat=%u level=%s result=%s\n"),
+				static_cast<double>(NowCycles - Cycles) * MillisecondsPerCycle,
+				CategoryIndex,
+				LELogVerbosityUtils::ToString(Level),
+				(Entry & 1ull) ? TEXT("allowed") : TEXT("filtered"));
+		}
+	}
+
+	return Result;
+}
@@ -0,0 +1,165 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "System/LEDropCounters.h"
+#include "Generated/LogEverythingCategoryTables.h"
+#include "Misc/ScopeLock.h"
+
+std::atomic<bool> FLEDropCounters::bHasUnreported{ false };
+
+namespace
+{
+	constexpr int32 NumSlots = LogEverythingGenerated::CategoryCount * FLEDropCountSnapshot::NumLevels;
+
+	/** 单个线程的计数表，只有所属线程写入 */
+	struct FLEThreadDropCounts
+	{
+		std::atomic<uint64> Counts[NumSlots] = {};
+	};
+
+	/** 所有存活线程的计数表与已退出线程的累计值，只在锁内访问 */
+	struct FLEDropCounterRegistry
+	{
+		FCriticalSection Lock;
+		TArray<FLEThreadDropCounts*> LiveThreads;
+		uint64 RetiredCounts[NumSlots] = {};
+		uint64 BaselineCounts[NumSlots] = {};
+
+		/** 已写入汇总日志的丢失总数（不减基线） */
+		uint64 ReportedTotal = 0;
+	};
+
+	FLEDropCounterRegistry& GetRegistry()
+	{
+		static FLEDropCounterRegistry Registry;
+		return Registry;
+	}
+
+	/** 线程本地句柄：首次丢失时注册，线程退出时把计数并入退役累计值 */
+	struct FLEThreadDropCountsHandle
+	{
+		FLEThreadDropCounts* Counts = nullptr;
+
+		FLEThreadDropCounts& GetOrRegister()
+		{
+			if (!Counts)
+			{
+				Counts = new FLEThreadDropCounts();
+				FLEDropCounterRegistry& Registry = GetRegistry();
+				FScopeLock Lock(&Registry.Lock);
+				Registry.LiveThreads.Add(Counts);
+			}
+			return *Counts;
+		}
+
+		~FLEThreadDropCountsHandle()
+		{
+			if (!Counts)
+			{
+				return;
+			}
+
+			FLEDropCounterRegistry& Registry = GetRegistry();
+			FScopeLock Lock(&Registry.Lock);
+			for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+			{
+				Registry.RetiredCounts[Slot] += Counts->Counts[Slot].load(std::memory_order_relaxed);
+			}
+			Registry.LiveThreads.RemoveSwap(Counts);
+			delete Counts;
+		}
+	};
+
+	/** 在锁内汇总原始计数（不减基线） */
+	void SumRawCounts(FLEDropCounterRegistry& Registry, uint64 (&OutCounts)[NumSlots])
+	{
+		FMemory::Memcpy(OutCounts, Registry.RetiredCounts, sizeof(OutCounts));
+		for (const FLEThreadDropCounts* ThreadCounts : Registry.LiveThreads)
+		{
+			for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+			{
+				OutCounts[Slot] += ThreadCounts->Counts[Slot].load(std::memory_order_relaxed);
+			}
+		}
+	}
+}
+
+void FLEDropCounters::RecordDrop(uint32 CategoryIndex, ELELogVerbosity Level)
+{
+	static thread_local FLEThreadDropCountsHandle ThreadHandle;
+
+	// 超出生成表的分类计入根分类，无效级别计入 Info（与发射路径的回退一致）
+	const uint32 Row = CategoryIndex < static_cast<uint32>(LogEverythingGenerated::CategoryCount) ? CategoryIndex : 0;
+	const uint32 Column = static_cast<uint8>(Level) < FLEDropCountSnapshot::NumLevels ? static_cast<uint8>(Level) : static_cast<uint8>(ELELogVerbosity::Info);
+
+	// 单写者：不需要原子读改写，读取方只会看到旧值或新值
+	std::atomic<uint64>& Counter = ThreadHandle.GetOrRegister().Counts[Row * FLEDropCountSnapshot::NumLevels + Column];
+	Counter.store(Counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+	// 先读后写：标志已置位时不写共享缓存行，release 使汇总方看到此前的计数
+	if (!bHasUnreported.load(std::memory_order_relaxed))
+	{
+		bHasUnreported.store(true, std::memory_order_release);
+	}
+}
+
+uint64 FLEDropCounters::ConsumeUnreported()
+{
+	if (!bHasUnreported.exchange(false, std::memory_order_acquire))
+	{
+		return 0;
+	}
+
+	uint64 RawCounts[NumSlots];
+	FLEDropCounterRegistry& Registry = GetRegistry();
+	FScopeLock Lock(&Registry.Lock);
+	SumRawCounts(Registry, RawCounts);
+
+	uint64 LifetimeTotal = 0;
+	for (const uint64 Count : RawCounts)
+	{
+		LifetimeTotal += Count;
+	}
+
+	const uint64 Unreported = LifetimeTotal - Registry.ReportedTotal;
+	Registry.ReportedTotal = LifetimeTotal;
+	return Unreported;
+}
+
+void FLEDropCounters::RestoreUnreported(uint64 Count)
+{
+	{
+		FLEDropCounterRegistry& Registry = GetRegistry();
+		FScopeLock Lock(&Registry.Lock);
+		Registry.ReportedTotal -= Count;
+	}
+	bHasUnreported.store(true, std::memory_order_release);
+}
+
+FLEDropCountSnapshot FLEDropCounters::Snapshot()
+{
+	uint64 RawCounts[NumSlots];
+	FLEDropCountSnapshot Result;
+	Result.Counts.SetNumUninitialized(NumSlots);
+
+	FLEDropCounterRegistry& Registry = GetRegistry();
+	FScopeLock Lock(&Registry.Lock);
+	SumRawCounts(Registry, RawCounts);
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		Result.Counts[Slot] = RawCounts[Slot] - Registry.BaselineCounts[Slot];
+		Result.Total += Result.Counts[Slot];
+	}
+	return Result;
+}
+
+uint64 FLEDropCounters::GetTotal()
+{
+	return Snapshot().Total;
+}
+
+void FLEDropCounters::Reset()
+{
+	FLEDropCounterRegistry& Registry = GetRegistry();
+	FScopeLock Lock(&Registry.Lock);
+	SumRawCounts(Registry, Registry.BaselineCounts);
+}
@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "System/LEFilterState.h"
+#include "System/LELogCallSite.h"
+#include "Utils/LogEverythingUtils.h"
+
+std::atomic<FLEFilterState*> FLEFilterState::ActiveState{ nullptr };
+
+FLEFilterState::FLEFilterState()
+	: Snapshot(CreateBootstrapSnapshot())
+	, ActiveTree(nullptr)
+{
+}
+
+FLEFilterState::~FLEFilterState()
+{
+	// 状态本身已经过纪元回收，此时不再有读者
+	delete Snapshot.exchange(nullptr, std::memory_order_relaxed);
+}
+
+void FLEFilterState::Startup()
+{
+	FLEFilterState* NewState = new FLEFilterState();
+	FLEFilterState* OldState = ActiveState.exchange(NewState, std::memory_order_seq_cst);
+	FLEEpochReclaimer::Retire(OldState);
+	LogEverything::InvalidateCallSites();
+
+	LE_SYSTEM_LOG(TEXT("Process-wide filter state published"));
+}
+
+void FLEFilterState::Shutdown()
+{
+	FLEFilterState* OldState = ActiveState.exchange(nullptr, std::memory_order_seq_cst);
+	LogEverything::InvalidateCallSites();
+	FLEEpochReclaimer::Retire(OldState);
+}
+
+bool FLEFilterState::ShouldLog(uint32 BqCategoryIndex, ELELogVerbosity Level)
+{
+	FLEEpochReadScope ReadScope;
+	const FLEFilterState* State = Get();
+	const FLECategoryFilterSnapshot* CurrentSnapshot = State ? State->GetSnapshot() : nullptr;
+	if (CurrentSnapshot)
+	{
+		return CurrentSnapshot->ShouldLog(BqCategoryIndex, Level);
+	}
+
+	// 模块加载前 / 卸载后：Info 及以上级别显示
+	return static_cast<uint8>(Level) >= static_cast<uint8>(ELELogVerbosity::Info);
+}
+
+void FLEFilterState::SetActiveTree(const FLECategoryTreeCore* InTree)
+{
+	FLEFilterState* State = ActiveState.load(std::memory_order_seq_cst);
+	if (!State)
+	{
+		return;
+	}
+
+	State->ActiveTree.store(InTree, std::memory_order_seq_cst);
+	if (InTree)
+	{
+		const FLECategoryFilterSnapshot* TreeSnapshot = InTree->CopyFilterSnapshot();
+		State->PublishSnapshot(TreeSnapshot ? TreeSnapshot : CreateBootstrapSnapshot());
+		LogEverything::InvalidateCallSites();
+	}
+}
+
+bool FLEFilterState::IsActiveTree(const FLECategoryTreeCore* InTree)
+{
+	const FLEFilterState* State = ActiveState.load(std::memory_order_seq_cst);
+	return State && InTree && State->ActiveTree.load(std::memory_order_seq_cst) == InTree;
+}
+
+void FLEFilterState::PublishFromTree(const FLECategoryTreeCore* InTree, const FLECategoryFilterSnapshot* TreeSnapshot)
+{
+	FLEFilterState* State = ActiveState.load(std::memory_order_seq_cst);
+	if (!State || !InTree || State->ActiveTree.load(std::memory_order_seq_cst) != InTree)
+	{
+		return;
+	}
+
+	State->PublishSnapshot(TreeSnapshot ? new FLECategoryFilterSnapshot(*TreeSnapshot) : CreateBootstrapSnapshot());
+}
+
+void FLEFilterState::PublishSnapshot(const FLECategoryFilterSnapshot* NewSnapshot)
+{
+	const FLECategoryFilterSnapshot* OldSnapshot = Snapshot.exchange(NewSnapshot, std::memory_order_seq_cst);
+	FLEEpochReclaimer::Retire(OldSnapshot);
+}
+
+FLECategoryFilterSnapshot* FLEFilterState::CreateBootstrapSnapshot()
+{
+	FLECategoryFilterSnapshot* BootstrapSnapshot = new FLECategoryFilterSnapshot();
+	BootstrapSnapshot->DefaultFilterByte = static_cast<uint8>(ELELogVerbosity::Info);
+	return BootstrapSnapshot;
+}
@@ -2,6 +2,10 @@
 
 #include "System/LELogSubsystem.h"
 #include "System/LELogTypes.h"
+#include "System/LEDecisionTracer.h"
+#include "System/LEDropCounters.h"
+#include "System/LEFilterState.h"
+#include "System/LEObjectWatchList.h"
 #include "Utils/LogEverythingUtils.h"
 #include "Macros/LELogMacros.h"
 #include "Category/LECategoryDefine.h"
@@ -9,10 +13,70 @@
 #include "Engine/GameInstance.h"
 #include "HAL/IConsoleManager.h"
 #include "Generated/LogEverythingLogger.h"
+#include "Generated/LogEverythingCategoryTables.h"
 
 // 静态成员变量定义
 bool ULELogSubsystem::bStaticInitialized = false;
 
+namespace LogEverything
+{
+	namespace Private
+	{
+		static void OnCategoryRulesChanged(IConsoleVariable* Variable)
+		{
+			// 从配置文件加载时引擎可能尚未就绪，子系统初始化时会再读取一次
+			if (!GEngine)
+			{
+				return;
+			}
+
+			if (ULELogSubsystem* LogSubsystem = ULELogSubsystem::Get(nullptr))
+			{
+				LogSubsystem->SetCategoryRulesFromString(Variable->GetString());
+			}
+		}
+
+		static void OnReliabilityPolicyChanged(IConsoleVariable* Variable)
+		{
+			// 桥接层尚未初始化时不处理，子系统初始化时会把它并入初始设置
+			if (!FLEBqLogBridge::Get().IsInitialized())
+			{
+				return;
+			}
+
+			if (ULELogSubsystem* LogSubsystem = ULELogSubsystem::Get(nullptr))
+			{
+				LogSubsystem->SetReliabilityPolicyFromString(Variable->GetString());
+			}
+		}
+	}
+
+	namespace ConsoleVariable
+	{
+		/** Ordered category rules, settable from the console or [ConsoleVariables] in DefaultEngine.ini */
+		static TAutoConsoleVariable<FString> CategoryRules(
+			TEXT("LogEverything.CategoryRules"),
+			TEXT(""),
+			TEXT("Ordered LogEverything category rules separated by ';' (later rules win)\n")
+			TEXT("Pattern=Level sets a level, !Pattern disables; '*' matches within one component, '**' matches any number of components\n")
+			TEXT("Example: Game.*.Input=Warning;**.Pathfinding=Verbose;!Test.**"),
+			FConsoleVariableDelegate::CreateStatic(&Private::OnCategoryRulesChanged),
+			ECVF_Default
+		);
+
+		/** Per-level reliability policy, usually set per deployment in [ConsoleVariables] of DefaultEngine.ini */
+		static TAutoConsoleVariable<FString> ReliabilityPolicy(
+			TEXT("LogEverything.ReliabilityPolicy"),
+			TEXT(""),
+			TEXT("What happens to an entry when the BqLog buffer is full, per level: Drop, Block (wait up to BlockTimeoutMs) or Guaranteed\n")
+			TEXT("(also written to a high-reliability, crash-recoverable logger). Unlisted levels keep their defaults\n")
+			TEXT("Example: Verbose=Drop,Debug=Drop,Warning=Block,Error=Guaranteed,Fatal=Guaranteed,BlockTimeoutMs=5"),
+			FConsoleVariableDelegate::CreateStatic(&Private::OnReliabilityPolicyChanged),
+			ECVF_Default
+		);
+	}
+}
+
 ULELogSubsystem::ULELogSubsystem()
 	: CategoryTree(nullptr)
 	, bIsInitialized(false)
@@ -38,7 +102,8 @@ void ULELogSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	DefaultSettings.GlobalLogLevel = ELELogVerbosity::Info;
 	DefaultSettings.bEnableAsyncLogging = true;
 	DefaultSettings.BufferSize = 1048576; // 1MB
-	DefaultSettings.LogFilePath = TEXT("Logs/LogEverything.log");
+	DefaultSettings.LogFilePath = TEXT("LogEverything/LE");
+	FLELogReliabilityPolicy::Parse(LogEverything::ConsoleVariable::ReliabilityPolicy.GetValueOnGameThread(), DefaultSettings.ReliabilityPolicy);
 
 	// 初始化 BqLog 桥接
 	if (FLEBqLogBridge::Get().Initialize(DefaultSettings, this))
@@ -60,6 +125,7 @@ void ULELogSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 	// 应用配置中的分类设置
 	ApplyDefaultCategoryConfigurations();
+	ApplyConfiguredCategoryRules();
 	
 	// 加载日志设置
 	if (!LoadLogSettings())
@@ -69,6 +135,7 @@ void ULELogSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 	bIsInitialized = true;
 	bStaticInitialized = true;
+	LogEverything::InvalidateCallSites();
 
 	LE_SYSTEM_LOG(TEXT("LogEverything Subsystem initialized successfully."));
 	
@@ -81,6 +148,10 @@ void ULELogSubsystem::Deinitialize()
 	Cleanup();
 	bIsInitialized = false;
 	bStaticInitialized = false;
+	FLEFilterState::SetActiveTree(nullptr);
+	LogEverything::InvalidateCallSites();
+	// 对象索引在会话之间会被复用，观察列表不跨子系统生命周期保留
+	FLEObjectWatchList::Clear();
 	FLEBqLogBridge::Get().Shutdown();
 	Super::Deinitialize();
 }
@@ -123,20 +194,20 @@ ULELogSubsystem* ULELogSubsystem::Get(const UObject* WorldContextObject)
 
 bool ULELogSubsystem::SetCategoryLevel(const FName& CategoryPath, ELELogVerbosity Level, bool bPropagate)
 {
-	if (!IsValid(CategoryTree))
+	if (!CategoryTreeCore.IsValid())
 	{
 		LE_SYSTEM_WARNING(TEXT("CategoryTree is null, cannot set category level"));
 		return false;
 	}
 
-	bool bResult = CategoryTree->SetCategoryLevel(CategoryPath.ToString(), Level, bPropagate);
+	bool bResult = CategoryTreeCore->SetCategoryLevel(CategoryPath.ToString(), Level, bPropagate);
 	
 	if (bResult)
 	{
-		if (LogEverything::ConsoleVariable::DebugLogCategory.GetValueOnGameThread())
+		if (FLEDecisionTracer::IsEnabled())
 		{
 			LE_SYSTEM_LOG(TEXT("Set category level: %s = %s (propagate: %s)"),
-				*CategoryPath.ToString(), *UEnum::GetValueAsString(Level), bPropagate ? TEXT("true") : TEXT("false"));
+				*CategoryPath.ToString(), LELogVerbosityUtils::ToString(Level), bPropagate ? TEXT("true") : TEXT("false"));
 		}
 	}
 	else
@@ -147,35 +218,222 @@ bool ULELogSubsystem::SetCategoryLevel(const FName& CategoryPath, ELELogVerbosit
 	return bResult;
 }
 
+int32 ULELogSubsystem::ApplyCategoryLevels(const TArray<FLECategoryLevel>& CategoryLevels, bool bPropagate)
+{
+	FLECategoryTreeTransaction Transaction;
+	Transaction.Reserve(CategoryLevels.Num());
+	for (const FLECategoryLevel& CategoryLevel : CategoryLevels)
+	{
+		Transaction.SetCategoryLevel(CategoryLevel.CategoryName.ToString(), CategoryLevel.LogLevel, bPropagate);
+	}
+
+	return ApplyCategoryTransaction(Transaction);
+}
+
+int32 ULELogSubsystem::ApplyCategoryTransaction(const FLECategoryTreeTransaction& Transaction)
+{
+	if (!CategoryTreeCore.IsValid())
+	{
+		LE_SYSTEM_WARNING(TEXT("CategoryTree is null, cannot apply category transaction"));
+		return 0;
+	}
+
+	// 汇总日志由分类树核心输出，这里不再逐条记录
+	return CategoryTreeCore->ApplyTransaction(Transaction);
+}
+
+bool ULELogSubsystem::SetCategoryRules(const TArray<FString>& Rules)
+{
+	if (!CategoryTreeCore.IsValid())
+	{
+		LE_SYSTEM_WARNING(TEXT("CategoryTree is null, cannot set category rules"));
+		return false;
+	}
+
+	bool bAllValid = true;
+	TArray<FLECategoryRule> ParsedRules;
+	ParsedRules.Reserve(Rules.Num());
+	for (const FString& RuleText : Rules)
+	{
+		FLECategoryRule Rule;
+		if (FLECategoryRule::Parse(RuleText, Rule))
+		{
+			ParsedRules.Add(MoveTemp(Rule));
+		}
+		else
+		{
+			LE_SYSTEM_WARNING(TEXT("Invalid category rule: %s"), *RuleText);
+			bAllValid = false;
+		}
+	}
+
+	CategoryTreeCore->SetCategoryRules(MoveTemp(ParsedRules));
+	return bAllValid;
+}
+
+TArray<FString> ULELogSubsystem::GetCategoryRules() const
+{
+	TArray<FString> Rules;
+	if (CategoryTreeCore.IsValid())
+	{
+		for (const FLECategoryRule& Rule : CategoryTreeCore->GetCategoryRules())
+		{
+			Rules.Add(Rule.ToString());
+		}
+	}
+
+	return Rules;
+}
+
+bool ULELogSubsystem::WatchObject(const UObject* Object)
+{
+	if (!FLEObjectWatchList::WatchObject(Object))
+	{
+		return false;
+	}
+
+	LE_SYSTEM_LOG(TEXT("Watching object %s (id %llu)"), *GetPathNameSafe(Object), FLEObjectWatchList::GetObjectId(Object));
+	return true;
+}
+
+bool ULELogSubsystem::UnwatchObject(const UObject* Object)
+{
+	return FLEObjectWatchList::UnwatchObject(Object);
+}
+
+bool ULELogSubsystem::WatchEntity(int64 EntityId)
+{
+	return FLEObjectWatchList::WatchId(static_cast<uint64>(EntityId));
+}
+
+bool ULELogSubsystem::UnwatchEntity(int64 EntityId)
+{
+	return FLEObjectWatchList::UnwatchId(static_cast<uint64>(EntityId));
+}
+
+void ULELogSubsystem::ClearWatchList()
+{
+	FLEObjectWatchList::Clear();
+}
+
+TArray<int64> ULELogSubsystem::GetWatchedIds() const
+{
+	TArray<int64> Ids;
+	for (const uint64 Id : FLEObjectWatchList::GetWatchedIds())
+	{
+		Ids.Add(static_cast<int64>(Id));
+	}
+	return Ids;
+}
+
+bool ULELogSubsystem::SetCategoryRulesFromString(const FString& RulesText)
+{
+	if (!CategoryTreeCore.IsValid())
+	{
+		LE_SYSTEM_WARNING(TEXT("CategoryTree is null, cannot set category rules"));
+		return false;
+	}
+
+	TArray<FLECategoryRule> ParsedRules;
+	const bool bAllValid = FLECategoryRule::ParseList(RulesText, ParsedRules);
+	CategoryTreeCore->SetCategoryRules(MoveTemp(ParsedRules));
+	return bAllValid;
+}
+
+bool ULELogSubsystem::SetReliabilityPolicy(const FLELogReliabilityPolicy& Policy)
+{
+	return FLEBqLogBridge::Get().SetReliabilityPolicy(Policy);
+}
+
+FLELogReliabilityPolicy ULELogSubsystem::GetReliabilityPolicy() const
+{
+	return FLEBqLogBridge::Get().GetReliabilityPolicy();
+}
+
+bool ULELogSubsystem::SetReliabilityPolicyFromString(const FString& PolicyText)
+{
+	// 未提及的级别保持当前策略
+	FLELogReliabilityPolicy Policy = GetReliabilityPolicy();
+	const bool bAllValid = FLELogReliabilityPolicy::Parse(PolicyText, Policy);
+	return SetReliabilityPolicy(Policy) && bAllValid;
+}
+
+bool ULELogSubsystem::SetLogRoutes(const TArray<FLELogRoute>& Routes)
+{
+	return FLEBqLogBridge::Get().SetRoutes(Routes);
+}
+
+TArray<FLELogRoute> ULELogSubsystem::GetLogRoutes() const
+{
+	return FLEBqLogBridge::Get().GetRoutes();
+}
+
+int64 ULELogSubsystem::GetDroppedEntryCount() const
+{
+	return static_cast<int64>(FLEDropCounters::GetTotal());
+}
+
+TArray<FLEDroppedEntryStat> ULELogSubsystem::GetDroppedEntryStats() const
+{
+	const FLEDropCountSnapshot Snapshot = FLEDropCounters::Snapshot();
+
+	TArray<FLEDroppedEntryStat> Stats;
+	for (int32 CategoryIndex = 0; CategoryIndex < Snapshot.NumCategories(); ++CategoryIndex)
+	{
+		for (int32 Level = 0; Level < FLEDropCountSnapshot::NumLevels; ++Level)
+		{
+			const uint64 Count = Snapshot.Get(CategoryIndex, static_cast<ELELogVerbosity>(Level));
+			if (Count == 0)
+			{
+				continue;
+			}
+
+			FLEDroppedEntryStat& Stat = Stats.AddDefaulted_GetRef();
+			Stat.Category = FName(LogEverythingGenerated::CategoryFullNames[CategoryIndex]);
+			Stat.Level = static_cast<ELELogVerbosity>(Level);
+			Stat.Count = static_cast<int64>(Count);
+		}
+	}
+
+	Stats.Sort([](const FLEDroppedEntryStat& A, const FLEDroppedEntryStat& B) { return A.Count > B.Count; });
+	return Stats;
+}
+
+void ULELogSubsystem::ResetDroppedEntryStats()
+{
+	FLEDropCounters::Reset();
+	LE_SYSTEM_LOG(TEXT("Dropped entry statistics reset"));
+}
+
 ELELogVerbosity ULELogSubsystem::GetEffectiveLevel(const FName& CategoryPath) const
 {
-	if (!IsValid(CategoryTree))
+	if (!CategoryTreeCore.IsValid())
 	{
 		return ELELogVerbosity::Info; // 默认级别
 	}
 
-	return CategoryTree->GetEffectiveLevel(CategoryPath.ToString());
+	return CategoryTreeCore->GetEffectiveLevel(CategoryPath.ToString());
 }
 
 bool ULELogSubsystem::ShouldLogCategory(const FName& CategoryName, ELELogVerbosity Level) const
 {
 
 	bool bShouldLog = false;
-	if (!IsValid(CategoryTree))
+	if (!CategoryTreeCore.IsValid())
 	{
 		// 默认规则：Info 及以上级别显示
 		bShouldLog = static_cast<uint8>(Level) >= static_cast<uint8>(ELELogVerbosity::Info);
 	}
 	else
 	{
-		bShouldLog = CategoryTree->ShouldLogCategory(CategoryName, Level);
+		bShouldLog = CategoryTreeCore->ShouldLogCategory(CategoryName, Level);
 	}
 
-	// 调试日志输出
-	if (LogEverything::ConsoleVariable::DebugLogCategory.GetValueOnGameThread())
+	// 决策追踪：只记录到追踪器，不重新进入日志系统
+	if (FLEDecisionTracer::IsEnabled())
 	{
-		LE_LOG_DEBUG(LELogTestLogSystem, TEXT("[ShouldLogCategory] ShouldLogCategory: {}, Level={}, Result={}"),
-			CategoryName.ToString(), UEnum::GetValueAsString(Level), bShouldLog ? TEXT("true") : TEXT("false"));
+		FLEDecisionTracer::Record(CategoryTreeCore.IsValid() ? CategoryTreeCore->GetBqCategoryIndex(CategoryName) : INDEX_NONE,
+			Level, bShouldLog);
 	}
 
 	return bShouldLog;
@@ -183,18 +441,21 @@ bool ULELogSubsystem::ShouldLogCategory(const FName& CategoryName, ELELogVerbosi
 
 bool ULELogSubsystem::SetCategoryEnabled(const FName& CategoryPath, bool bEnabled, bool bPropagate)
 {
-	if (!IsValid(CategoryTree))
+	if (!CategoryTreeCore.IsValid())
 	{
 		LE_SYSTEM_WARNING(TEXT("CategoryTree is null, cannot set category enabled state"));
 		return false;
 	}
 
-	bool bResult = CategoryTree->SetCategoryEnabled(CategoryPath.ToString(), bEnabled, bPropagate);
+	bool bResult = CategoryTreeCore->SetCategoryEnabled(CategoryPath.ToString(), bEnabled, bPropagate);
 
 	if (bResult)
 	{
-		LE_SYSTEM_LOG(TEXT("Set category enabled: %s = %s (propagate: %s)"),
-			*CategoryPath.ToString(), bEnabled ? TEXT("true") : TEXT("false"), bPropagate ? TEXT("true") : TEXT("false"));
+		if (FLEDecisionTracer::IsEnabled())
+		{
+			LE_SYSTEM_LOG(TEXT("Set category enabled: %s = %s (propagate: %s)"),
+				*CategoryPath.ToString(), bEnabled ? TEXT("true") : TEXT("false"), bPropagate ? TEXT("true") : TEXT("false"));
+		}
 	}
 	else
 	{
@@ -206,49 +467,49 @@ bool ULELogSubsystem::SetCategoryEnabled(const FName& CategoryPath, bool bEnable
 
 bool ULELogSubsystem::IsCategoryEnabled(const FName& CategoryPath) const
 {
-	if (!IsValid(CategoryTree))
+	if (!CategoryTreeCore.IsValid())
 	{
 		return true; // 默认启用
 	}
 
-	return CategoryTree->IsCategoryEnabled(CategoryPath.ToString());
+	return CategoryTreeCore->IsCategoryEnabled(CategoryPath.ToString());
 }
 
 TArray<FString> ULELogSubsystem::GetAllCategoryPaths() const
 {
-	if (!IsValid(CategoryTree))
+	if (!CategoryTreeCore.IsValid())
 	{
 		return TArray<FString>();
 	}
 
-	return CategoryTree->GetAllCategoryPaths();
+	return CategoryTreeCore->GetAllCategoryPaths();
 }
 
 TArray<FString> ULELogSubsystem::GetChildCategories(const FName& CategoryPath) const
 {
-	if (!IsValid(CategoryTree))
+	if (!CategoryTreeCore.IsValid())
 	{
 		return TArray<FString>();
 	}
 
-	return CategoryTree->GetChildCategories(CategoryPath.ToString());
+	return CategoryTreeCore->GetChildCategories(CategoryPath.ToString());
 }
 
 void ULELogSubsystem::ResetToDefault()
 {
-	if (!IsValid(CategoryTree))
+	if (!CategoryTreeCore.IsValid())
 	{
 		LE_SYSTEM_WARNING(TEXT("CategoryTree is null, cannot reset to default"));
 		return;
 	}
 
-	CategoryTree->ResetToDefault();
+	CategoryTreeCore->ResetToDefault();
 	LE_SYSTEM_LOG(TEXT("Reset category tree to default state"));
 }
 
 void ULELogSubsystem::GetTreeStatistics(int32& OutTotalNodes, int32& OutMaxDepth, int32& OutExplicitNodes) const
 {
-	if (!IsValid(CategoryTree))
+	if (!CategoryTreeCore.IsValid())
 	{
 		OutTotalNodes = 0;
 		OutMaxDepth = 0;
@@ -256,35 +517,35 @@ void ULELogSubsystem::GetTreeStatistics(int32& OutTotalNodes, int32& OutMaxDepth
 		return;
 	}
 
-	CategoryTree->GetTreeStatistics(OutTotalNodes, OutMaxDepth, OutExplicitNodes);
+	CategoryTreeCore->GetTreeStatistics(OutTotalNodes, OutMaxDepth, OutExplicitNodes);
 }
 
 FString ULELogSubsystem::ExportTreeDebugString() const
 {
-	if (!IsValid(CategoryTree))
+	if (!CategoryTreeCore.IsValid())
 	{
 		return TEXT("CategoryTree is null");
 	}
 
-	return CategoryTree->ExportTreeDebugString();
+	return CategoryTreeCore->ExportTreeDebugString();
 }
 
 bool ULELogSubsystem::ReinitializeCategoryTree()
 {
 	LE_SYSTEM_LOG(TEXT("Reinitializing category tree..."));
 
-	// 清理现有树
-	if (IsValid(CategoryTree))
-	{
-		CategoryTree->ConditionalBeginDestroy();
-		CategoryTree = nullptr;
-	}
-
-	// 重新初始化
+	// 分类树核心原地重建，不销毁对象：其他线程持有的共享指针始终有效
 	bool bResult = InitializeCategoryTree();
 	if (bResult)
 	{
 		ApplyDefaultCategoryConfigurations();
+
+		// 规则保存在分类树核心中，默认配置之后重新编译，保证规则优先于默认级别
+		TArray<FLECategoryRule> Rules = CategoryTreeCore->GetCategoryRules();
+		if (Rules.Num() > 0)
+		{
+			CategoryTreeCore->SetCategoryRules(MoveTemp(Rules));
+		}
 		LE_SYSTEM_LOG(TEXT("Category tree reinitialized successfully"));
 	}
 	else
@@ -312,34 +573,114 @@ bool ULELogSubsystem::ReloadLogSettings()
 	return bResult;
 }
 
+bool ULELogSubsystem::ApplyLogSettings(const FLELogSettings& Settings)
+{
+	if (!FLEBqLogBridge::Get().Reconfigure(Settings))
+	{
+		LE_SYSTEM_WARNING(TEXT("Failed to apply log settings to BqLog"));
+		return false;
+	}
+
+	SetGlobalLogLevel(Settings.GlobalLogLevel);
+	ApplyCategoryLevels(Settings.CategoryLevels);
+	SetFilterMode(Settings.FilterMode);
+	return true;
+}
+
 bool ULELogSubsystem::InitializeCategoryTree()
 {
-	// 创建分类树实例
-	CategoryTree = NewObject<ULECategoryTree>(this);
+	// 创建分类树核心（重新初始化时复用）
+	if (!CategoryTreeCore.IsValid())
+	{
+		CategoryTreeCore = MakeShared<FLECategoryTreeCore, ESPMode::ThreadSafe>();
+	}
+
+	// 蓝图门面只转发到同一个核心
 	if (!IsValid(CategoryTree))
 	{
-		LE_SYSTEM_ERROR(TEXT("Failed to create CategoryTree object"));
-		return false;
+		CategoryTree = NewObject<ULECategoryTree>(this);
+		if (!IsValid(CategoryTree))
+		{
+			LE_SYSTEM_ERROR(TEXT("Failed to create CategoryTree object"));
+			return false;
+		}
+		CategoryTree->SetCore(CategoryTreeCore.ToSharedRef());
 	}
 
-	// 获取所有预定义分类路径
-	TArray<FString> CategoryPaths;
-	if (!GetPredefinedCategoryPaths(CategoryPaths))
+	// 优先使用生成器引导表：结构直接复制，没有任何路径解析
+	const bool bBootstrapped = CanBootstrapFromGeneratedTables()
+		&& CategoryTreeCore->InitializeFromTables(LogEverythingGenerated::CategoryTreeTables);
+
+	if (!bBootstrapped)
+	{
+		// 回退：从 BqLog 接口读取分类路径并逐个插入
+		TArray<FString> CategoryPaths;
+		if (!GetPredefinedCategoryPaths(CategoryPaths))
+		{
+			LE_SYSTEM_ERROR(TEXT("Failed to get predefined category paths"));
+			return false;
+		}
+
+		// 初始化树结构
+		bool bResult = CategoryTreeCore->InitializeTree(CategoryPaths);
+		if (!bResult)
+		{
+			LE_SYSTEM_ERROR(TEXT("Failed to initialize category tree with predefined paths"));
+			return false;
+		}
+
+		// 绑定 BqLog 分类索引（CategoryPaths 下标即 CAT_INDEX），生成按索引排列的过滤表
+		if (!CategoryTreeCore->BindBqCategoryIndices(CategoryPaths))
+		{
+			LE_SYSTEM_WARNING(TEXT("Some BqLog category indices could not be bound to the category tree"));
+		}
+	}
+
+	// 子系统只是进程级过滤状态的视图：把分类树设为活动树，此后树的每次变化都会同步发布
+	FLEFilterState::SetActiveTree(CategoryTreeCore.Get());
+
+	FLEBqLogBridge& Bridge = FLEBqLogBridge::Get();
+	if (Bridge.IsNativeFilteringEnabled())
+	{
+		FLENativeCategoryFilter NativeFilter;
+		CategoryTreeCore->BuildNativeCategoryFilter(NativeFilter);
+		Bridge.ApplyNativeCategoryFilter(NativeFilter);
+	}
+
+	LE_SYSTEM_LOG(TEXT("Category tree initialized (%s)"), bBootstrapped ? TEXT("generated tables") : TEXT("parsed categories"));
+	return true;
+}
+
+bool ULELogSubsystem::CanBootstrapFromGeneratedTables() const
+{
+	const FLEBqLogBridge& Bridge = FLEBqLogBridge::Get();
+	const bq::LogEverythingLogger* CategoryLogInstance = Bridge.IsInitialized() ? Bridge.GetCategoryLogInstance() : nullptr;
+	if (!CategoryLogInstance)
 	{
-		LE_SYSTEM_ERROR(TEXT("Failed to get predefined category paths"));
 		return false;
 	}
 
-	// 初始化树结构
-	bool bResult = CategoryTree->InitializeTree(CategoryPaths);
-	if (!bResult)
+	// 引导表与 LogEverythingLogger.h 同时生成，分类数量一致即可认为匹配
+	if (CategoryLogInstance->get_categories_count() != static_cast<size_t>(LogEverythingGenerated::CategoryCount))
 	{
-		LE_SYSTEM_ERROR(TEXT("Failed to initialize category tree with predefined paths"));
-		CategoryTree = nullptr;
+		LE_SYSTEM_WARNING(TEXT("Generated category tables are stale (%d entries, BqLog has %d), run Tools/GenerateCategoryTables.py"),
+			LogEverythingGenerated::CategoryCount, static_cast<int32>(CategoryLogInstance->get_categories_count()));
 		return false;
 	}
 
-	LE_SYSTEM_LOG(TEXT("Category tree initialized with %d categories"), CategoryPaths.Num());
+#if !UE_BUILD_SHIPPING
+	// 开发版本再逐项比较名称，尽早发现忘记重新生成引导表的情况
+	const bq::array<bq::string>& CategoryNames = CategoryLogInstance->get_categories_name_array();
+	for (int32 BqIndex = 1; BqIndex < LogEverythingGenerated::CategoryCount; ++BqIndex)
+	{
+		if (FLEBqLogBridge::UTF8ToFString(CategoryNames[BqIndex].c_str()) != LogEverythingGenerated::CategoryFullNames[BqIndex])
+		{
+			LE_SYSTEM_WARNING(TEXT("Generated category tables are stale at index %d, run Tools/GenerateCategoryTables.py"), BqIndex);
+			return false;
+		}
+	}
+#endif
+
 	return true;
 }
 
@@ -383,17 +724,14 @@ bool ULELogSubsystem::ParseBqLogCategories(TArray<FString>& OutCategoryPaths) co
 
 	// 使用 BqLog 接口获取分类信息
 	uint32_t CategoryCount = static_cast<uint32_t>(CategoryLogInstance->get_categories_count());
-	const bq::array<bq::string> CategoryNames = CategoryLogInstance->get_categories_name_array();
+	const bq::array<bq::string>& CategoryNames = CategoryLogInstance->get_categories_name_array();
 	
 	// 将 BqLog 分类名称转换为 UE 字符串数组
+	// 保留空字符串（根分类）占位，使数组下标与 BqLog 分类索引一致
+	OutCategoryPaths.Reserve(CategoryCount);
 	for (uint32_t i = 0; i < CategoryCount; ++i)
 	{
-		FString CategoryName = FLEBqLogBridge::UTF8ToFString(CategoryNames[i].c_str());
-		// 跳过空字符串（根分类）
-		if (!CategoryName.IsEmpty())
-		{
-			OutCategoryPaths.Add(CategoryName);
-		}
+		OutCategoryPaths.Add(FLEBqLogBridge::UTF8ToFString(CategoryNames[i].c_str()));
 	}
 
 	LE_SYSTEM_LOG(TEXT("Successfully retrieved %d categories from BqLog interface"), OutCategoryPaths.Num());
@@ -423,27 +761,37 @@ bool ULELogSubsystem::GetPredefinedCategoryPaths(TArray<FString>& OutCategoryPat
 
 void ULELogSubsystem::ApplyDefaultCategoryConfigurations()
 {
-	if (!IsValid(CategoryTree))
+	if (!CategoryTreeCore.IsValid())
 	{
 		LE_SYSTEM_WARNING(TEXT("CategoryTree is null, skipping configuration"));
 		return;
 	}
 
-	CategoryTree->SetCategoryLevel(LELogEngine.GetCategoryName().ToString(), ELELogVerbosity::Info, false);
-	CategoryTree->SetCategoryLevel(LELogGame.GetCategoryName().ToString(), ELELogVerbosity::Verbose, false);
-	CategoryTree->SetCategoryLevel(LELogEditor.GetCategoryName().ToString(), ELELogVerbosity::Info, false);
-	CategoryTree->SetCategoryLevel(LELogTest.GetCategoryName().ToString(), ELELogVerbosity::Verbose, false);
+	FLECategoryTreeTransaction Transaction;
+	Transaction
+		.SetCategoryLevel(LELogEngine.GetCategoryName().ToString(), ELELogVerbosity::Info)
+		.SetCategoryLevel(LELogGame.GetCategoryName().ToString(), ELELogVerbosity::Verbose)
+		.SetCategoryLevel(LELogEditor.GetCategoryName().ToString(), ELELogVerbosity::Info)
+		.SetCategoryLevel(LELogTest.GetCategoryName().ToString(), ELELogVerbosity::Verbose);
+	CategoryTreeCore->ApplyTransaction(Transaction);
 
 	LE_SYSTEM_LOG(TEXT("Applied default category configurations"));
 }
 
-void ULELogSubsystem::Cleanup()
+void ULELogSubsystem::ApplyConfiguredCategoryRules()
 {
-	if (IsValid(CategoryTree))
+	const FString RulesText = LogEverything::ConsoleVariable::CategoryRules.GetValueOnGameThread();
+	if (!RulesText.IsEmpty())
 	{
-		CategoryTree->ConditionalBeginDestroy();
-		CategoryTree = nullptr;
+		SetCategoryRulesFromString(RulesText);
 	}
+}
+
+void ULELogSubsystem::Cleanup()
+{
+	// 门面交给 GC 回收；核心在最后一个共享指针释放时销毁
+	CategoryTree = nullptr;
+	CategoryTreeCore.Reset();
 
 	LE_SYSTEM_LOG(TEXT("LogEverything Subsystem cleanup completed"));
 }
@@ -458,4 +806,23 @@ void ULELogSubsystem::SetGlobalLogLevel(ELELogVerbosity Level)
 ELELogVerbosity ULELogSubsystem::GetGlobalLogLevel() const
 {
 	return GlobalLogLevel;
-}
\ No newline at end of file
+}
+
+void ULELogSubsystem::SetFilterMode(ELEFilterMode FilterMode)
+{
+	FLEBqLogBridge& Bridge = FLEBqLogBridge::Get();
+	Bridge.SetFilterMode(FilterMode);
+
+	// 切到原生模式后立即把当前分类树编译进 BqLog
+	if (Bridge.IsNativeFilteringEnabled() && CategoryTreeCore.IsValid())
+	{
+		FLENativeCategoryFilter NativeFilter;
+		CategoryTreeCore->BuildNativeCategoryFilter(NativeFilter);
+		Bridge.ApplyNativeCategoryFilter(NativeFilter);
+	}
+}
+
+ELEFilterMode ULELogSubsystem::GetFilterMode() const
+{
+	return FLEBqLogBridge::Get().IsNativeFilteringEnabled() ? ELEFilterMode::NativeBqLog : ELEFilterMode::CategoryTree;
+}
@@ -0,0 +1,139 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "System/LELogTypes.h"
+#include "Utils/LogEverythingUtils.h"
+#include "String/ParseTokens.h"
+
+namespace
+{
+	const FStringView BlockTimeoutKey = TEXTVIEW("BlockTimeoutMs");
+
+	bool TryParseReliability(FStringView Text, ELELogReliability& OutReliability)
+	{
+		if (Text.Equals(TEXTVIEW("Drop"), ESearchCase::IgnoreCase))
+		{
+			OutReliability = ELELogReliability::Drop;
+		}
+		else if (Text.Equals(TEXTVIEW("Block"), ESearchCase::IgnoreCase))
+		{
+			OutReliability = ELELogReliability::Block;
+		}
+		else if (Text.Equals(TEXTVIEW("Guaranteed"), ESearchCase::IgnoreCase))
+		{
+			OutReliability = ELELogReliability::Guaranteed;
+		}
+		else
+		{
+			return false;
+		}
+		return true;
+	}
+
+	const TCHAR* ReliabilityToString(ELELogReliability Reliability)
+	{
+		switch (Reliability)
+		{
+		case ELELogReliability::Drop:       return TEXT("Drop");
+		case ELELogReliability::Block:      return TEXT("Block");
+		case ELELogReliability::Guaranteed: return TEXT("Guaranteed");
+		default:                            return TEXT("Unknown");
+		}
+	}
+}
+
+ELELogReliability FLELogReliabilityPolicy::GetForLevel(ELELogVerbosity Level) const
+{
+	switch (Level)
+	{
+	case ELELogVerbosity::Verbose:  return Verbose;
+	case ELELogVerbosity::Debug:    return Debug;
+	case ELELogVerbosity::Info:     return Info;
+	case ELELogVerbosity::Warning:  return Warning;
+	case ELELogVerbosity::Error:    return Error;
+	case ELELogVerbosity::Fatal:    return Fatal;
+	default:                        return ELELogReliability::Drop;
+	}
+}
+
+void FLELogReliabilityPolicy::SetForLevel(ELELogVerbosity Level, ELELogReliability Reliability)
+{
+	switch (Level)
+	{
+	case ELELogVerbosity::Verbose:  Verbose = Reliability; break;
+	case ELELogVerbosity::Debug:    Debug = Reliability; break;
+	case ELELogVerbosity::Info:     Info = Reliability; break;
+	case ELELogVerbosity::Warning:  Warning = Reliability; break;
+	case ELELogVerbosity::Error:    Error = Reliability; break;
+	case ELELogVerbosity::Fatal:    Fatal = Reliability; break;
+	default:                        break;
+	}
+}
+
+bool FLELogReliabilityPolicy::RequiresGuaranteedLogger() const
+{
+	for (uint8 Level = 0; Level <= static_cast<uint8>(ELELogVerbosity::Fatal); ++Level)
+	{
+		if (GetForLevel(static_cast<ELELogVerbosity>(Level)) == ELELogReliability::Guaranteed)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FLELogReliabilityPolicy::Parse(FStringView PolicyText, FLELogReliabilityPolicy& InOutPolicy)
+{
+	static const TCHAR Delimiters[] = { TEXT(';'), TEXT(','), TEXT(' '), TEXT('\t'), TEXT('\r'), TEXT('\n') };
+
+	bool bAllValid = true;
+	UE::String::ParseTokensMultiple(PolicyText, MakeArrayView(Delimiters, UE_ARRAY_COUNT(Delimiters)), [&InOutPolicy, &bAllValid](FStringView Entry)
+	{
+		int32 EqualsIndex = INDEX_NONE;
+		bool bValid = Entry.FindChar(TEXT('='), EqualsIndex);
+		if (bValid)
+		{
+			const FStringView Key = Entry.Left(EqualsIndex).TrimStartAndEnd();
+			const FStringView Value = Entry.RightChop(EqualsIndex + 1).TrimStartAndEnd();
+
+			ELELogVerbosity Level = ELELogVerbosity::Info;
+			ELELogReliability Reliability = ELELogReliability::Drop;
+			if (Key.Equals(BlockTimeoutKey, ESearchCase::IgnoreCase))
+			{
+				const FString ValueString(Value);
+				bValid = ValueString.IsNumeric();
+				if (bValid)
+				{
+					InOutPolicy.BlockTimeoutMs = FMath::Clamp(FCString::Atoi(*ValueString), 0, 1000);
+				}
+			}
+			else if (LELogVerbosityUtils::TryParse(Key, Level) && Level != ELELogVerbosity::NoLogging && TryParseReliability(Value, Reliability))
+			{
+				InOutPolicy.SetForLevel(Level, Reliability);
+			}
+			else
+			{
+				bValid = false;
+			}
+		}
+
+		if (!bValid)
+		{
+			LE_SYSTEM_WARNING(TEXT("Invalid reliability policy entry: %s"), *FString(Entry));
+			bAllValid = false;
+		}
+	}, UE::String::EParseTokensOptions::SkipEmpty);
+
+	return bAllValid;
+}
+
+FString FLELogReliabilityPolicy::ToString() const
+{
+	TStringBuilder<256> Builder;
+	for (uint8 Level = 0; Level <= static_cast<uint8>(ELELogVerbosity::Fatal); ++Level)
+	{
+		const ELELogVerbosity Verbosity = static_cast<ELELogVerbosity>(Level);
+		Builder.Appendf(TEXT("%s=%s,"), LELogVerbosityUtils::ToString(Verbosity), ReliabilityToString(GetForLevel(Verbosity)));
+	}
+	Builder.Appendf(TEXT("%s=%d"), *FString(BlockTimeoutKey), BlockTimeoutMs);
+	return FString(Builder.ToView());
+}
@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "System/LEObjectWatchList.h"
+#include "Bridge/LEBqLogBridge.h"
+#include "Utils/LogEverythingUtils.h"
+#include "Misc/ScopeLock.h"
+
+std::atomic<int32> FLEObjectWatchList::NumWatched{ 0 };
+std::atomic<uint64> FLEObjectWatchList::BloomBits[FLEObjectWatchList::BloomWords] = {};
+
+namespace
+{
+	FCriticalSection& GetWatchListLock()
+	{
+		static FCriticalSection Lock;
+		return Lock;
+	}
+
+	/** 精确集合，只在锁内访问 */
+	TSet<uint64>& GetWatchedSet()
+	{
+		static TSet<uint64> WatchedSet;
+		return WatchedSet;
+	}
+}
+
+bool FLEObjectWatchList::WatchObject(const UObjectBase* Object)
+{
+	if (!Object)
+	{
+		return false;
+	}
+
+	// 弱指针同样依赖序列号区分复用的对象槽位；分配后热路径上的 GetSerialNumber 即可读到它
+	const int32 ObjectIndex = GUObjectArray.ObjectToIndex(Object);
+	GUObjectArray.AllocateSerialNumber(ObjectIndex);
+	return WatchId(GetObjectId(Object));
+}
+
+bool FLEObjectWatchList::UnwatchObject(const UObjectBase* Object)
+{
+	return Object && UnwatchId(GetObjectId(Object));
+}
+
+bool FLEObjectWatchList::WatchId(uint64 Id)
+{
+	if (Id == 0)
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&GetWatchListLock());
+	bool bAlreadyWatched = false;
+	GetWatchedSet().Add(Id, &bAlreadyWatched);
+	if (bAlreadyWatched)
+	{
+		return false;
+	}
+
+	// 先置位再发布数量；读取方使用 relaxed load，刚加入的 ID 最多漏掉并发中的少量日志
+	RebuildBloom();
+	NumWatched.store(GetWatchedSet().Num(), std::memory_order_release);
+
+	// 原生过滤模式下 BqLog 会拦截低于阈值的日志，观察列表非空期间放宽（在锁内切换，保证与观察数一致）
+	if (GetWatchedSet().Num() == 1)
+	{
+		FLEBqLogBridge::Get().SetNativeFilterRelaxed(true);
+	}
+	return true;
+}
+
+bool FLEObjectWatchList::UnwatchId(uint64 Id)
+{
+	FScopeLock Lock(&GetWatchListLock());
+	if (GetWatchedSet().Remove(Id) == 0)
+	{
+		return false;
+	}
+
+	NumWatched.store(GetWatchedSet().Num(), std::memory_order_release);
+	RebuildBloom();
+	if (GetWatchedSet().Num() == 0)
+	{
+		FLEBqLogBridge::Get().SetNativeFilterRelaxed(false);
+	}
+	return true;
+}
+
+void FLEObjectWatchList::Clear()
+{
+	FScopeLock Lock(&GetWatchListLock());
+	GetWatchedSet().Reset();
+	NumWatched.store(0, std::memory_order_release);
+	RebuildBloom();
+	FLEBqLogBridge::Get().SetNativeFilterRelaxed(false);
+}
+
+TArray<uint64> FLEObjectWatchList::GetWatchedIds()
+{
+	FScopeLock Lock(&GetWatchListLock());
+	return GetWatchedSet().Array();
+}
+
+bool FLEObjectWatchList::ContainsExact(uint64 Id)
+{
+	FScopeLock Lock(&GetWatchListLock());
+	return GetWatchedSet().Contains(Id);
+}
+
+void FLEObjectWatchList::RebuildBloom()
+{
+	uint64 NewBits[BloomWords] = {};
+	for (const uint64 Id : GetWatchedSet())
+	{
+		const uint64 Hash = HashId(Id);
+		const uint32 BitA = static_cast<uint32>(Hash) & (BloomWords * 64 - 1);
+		const uint32 BitB = static_cast<uint32>(Hash >> 32) & (BloomWords * 64 - 1);
+		NewBits[BitA >> 6] |= 1ull << (BitA & 63);
+		NewBits[BitB >> 6] |= 1ull << (BitB & 63);
+	}
+
+	for (uint32 Word = 0; Word < BloomWords; ++Word)
+	{
+		BloomBits[Word].store(NewBits[Word], std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "System/LEScopedVerbosity.h"
+#include "Utils/LogEverythingUtils.h"
+#include "Generated/LogEverythingCategoryTables.h"
+
+uint32 FLEScopedVerbosity::DepthTlsSlot = FPlatformTLS::AllocTlsSlot();
+std::atomic<int32> FLEScopedVerbosity::ActiveCount{ 0 };
+
+namespace
+{
+	/** 单个覆盖：BqLog 分类前序区间 [Begin, End) 与覆盖级别 */
+	struct FLEVerbosityOverride
+	{
+		uint32 Begin;
+		uint32 End;
+		ELELogVerbosity Level;
+	};
+
+	/** 线程本地覆盖栈 */
+	struct FLEVerbosityOverlay
+	{
+		FLEVerbosityOverride Entries[FLEScopedVerbosity::MaxDepth];
+		int32 Num = 0;
+	};
+
+	FLEVerbosityOverlay& GetThreadOverlay()
+	{
+		static thread_local FLEVerbosityOverlay Overlay;
+		return Overlay;
+	}
+}
+
+void FLEScopedVerbosity::Push(uint32 BqCategoryIndex, ELELogVerbosity Level)
+{
+	FLEVerbosityOverlay& Overlay = GetThreadOverlay();
+	if (Overlay.Num >= MaxDepth)
+	{
+		LE_SYSTEM_WARNING(TEXT("Scoped verbosity override ignored: more than %d nested overrides on this thread"), MaxDepth);
+		return;
+	}
+
+	// BqLog 分类按前序排列，子树即生成表中的 [Index, SubtreeEnd)
+	const uint32 End = BqCategoryIndex < static_cast<uint32>(LogEverythingGenerated::CategoryCount)
+		? static_cast<uint32>(LogEverythingGenerated::CategoryNodeLinks[BqCategoryIndex].SubtreeEnd)
+		: BqCategoryIndex + 1;
+
+	Overlay.Entries[Overlay.Num++] = { BqCategoryIndex, End, Level };
+	FPlatformTLS::SetTlsValue(DepthTlsSlot, reinterpret_cast<void*>(static_cast<UPTRINT>(Overlay.Num)));
+	ActiveCount.fetch_add(1, std::memory_order_relaxed);
+	bPushed = true;
+}
+
+FLEScopedVerbosity::~FLEScopedVerbosity()
+{
+	if (!bPushed)
+	{
+		return;
+	}
+
+	// RAII 保证同一线程内按后进先出的顺序出栈
+	FLEVerbosityOverlay& Overlay = GetThreadOverlay();
+	check(Overlay.Num > 0);
+	--Overlay.Num;
+	FPlatformTLS::SetTlsValue(DepthTlsSlot, reinterpret_cast<void*>(static_cast<UPTRINT>(Overlay.Num)));
+	ActiveCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool FLEScopedVerbosity::FindOverride(uint32 BqCategoryIndex, ELELogVerbosity& OutLevel)
+{
+	const FLEVerbosityOverlay& Overlay = GetThreadOverlay();
+	for (int32 Index = Overlay.Num - 1; Index >= 0; --Index)
+	{
+		const FLEVerbosityOverride& Override = Overlay.Entries[Index];
+		if (BqCategoryIndex >= Override.Begin && BqCategoryIndex < Override.End)
+		{
+			OutLevel = Override.Level;
+			return true;
+		}
+	}
+	return false;
+}
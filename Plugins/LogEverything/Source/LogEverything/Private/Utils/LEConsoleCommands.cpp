@@ -1,10 +1,18 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
+#include "Bridge/LEBqLogConfig.h"
 #include "Category/LECategoryDefine.h"
+#include "Category/LECategoryTreeCore.h"
 #include "Macros/LELogMacros.h"
 #include "System/LELogSubsystem.h"
+#include "System/LEDecisionTracer.h"
+#include "System/LEScopedVerbosity.h"
+#include "System/LEObjectWatchList.h"
+#include "Async/Async.h"
 #include "Engine/Engine.h"
 #include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
 
 // =============================================================================
 // LogEverything Namespace - Console Variables & Test Functions
@@ -14,6 +22,49 @@ namespace LogEverything
 {
 	namespace ConsoleFunction
 	{
+		/**
+		 * LE.Test.* 共用的检查计数：失败项逐条输出，结束时汇总结果
+		 * Shared pass/fail bookkeeping for the LE.Test.* console commands
+		 */
+		struct FLETestChecks
+		{
+			explicit FLETestChecks(const TCHAR* InTestName)
+				: TestName(InTestName)
+			{
+			}
+
+			/** 记录一项失败 */
+			void Fail(const TCHAR* Check)
+			{
+				LE_LOG_ERROR(LELogTestLogSystem, TEXT("FAIL {}"), Check);
+				++NumFailed;
+			}
+
+			/** 条件不成立时记录失败 */
+			void Expect(const TCHAR* Check, bool bCondition)
+			{
+				if (!bCondition)
+				{
+					Fail(Check);
+				}
+			}
+
+			/** 输出测试结果 */
+			void Report() const
+			{
+				if (NumFailed == 0)
+				{
+					LE_LOG_DEBUG(LELogTestLogSystem, TEXT("{}: all checks passed"), TestName);
+				}
+				else
+				{
+					LE_LOG_ERROR(LELogTestLogSystem, TEXT("{}: {} checks failed"), TestName, NumFailed);
+				}
+			}
+
+			const TCHAR* TestName;
+			int32 NumFailed = 0;
+		};
 
 		// =============================================================================
 		// Conditional logging test command
@@ -109,7 +160,7 @@ namespace LogEverything
 
 				// Check whether a Verbose log should be recorded
 				bool bShouldLog = LogSubsystem->ShouldLogCategory(TestCategoryName, ELELogVerbosity::Verbose);
-				if (LogEverything::ConsoleVariable::DebugLogCategory.GetValueOnGameThread())
+				if (FLEDecisionTracer::IsEnabled())
 				{
 					LE_LOG_DEBUG(LELogTestLogSystem, TEXT("[Debug] Should Verbose log be recorded: {}"), bShouldLog ? TEXT("Yes") : TEXT("No"));
 				}
@@ -117,7 +168,7 @@ namespace LogEverything
 				// Attempt to emit a Verbose log
 				LE_LOG_VERBOSE(LELogTestLogSystem, TEXT("Another Verbose-level test log (may be filtered)"));
 
-				if (!bShouldLog && LogEverything::ConsoleVariable::DebugLogCategory.GetValueOnGameThread())
+				if (!bShouldLog && FLEDecisionTracer::IsEnabled())
 				{
 					LE_LOG_DEBUG(LELogTestLogSystem, TEXT("[Debug] Verbose log was filtered by level"));
 				}
@@ -125,10 +176,10 @@ namespace LogEverything
 
 				// === Step 5: Test CVar controls ===
 				LE_LOG_DEBUG(LELogTestLogSystem, TEXT("Step 5: Demonstrate CVar toggling for debug output"));
-				LE_LOG_DEBUG(LELogTestLogSystem, TEXT("Current LogEverything.DebugLogCategory = {}"),
-				             LogEverything::ConsoleVariable::DebugLogCategory.GetValueOnGameThread() ? TEXT("true") : TEXT("false"));
-				LE_LOG_DEBUG(LELogTestLogSystem, TEXT("Run command: LogEverything.DebugLogCategory 1 (enable debug output)"));
-				LE_LOG_DEBUG(LELogTestLogSystem, TEXT("Run command: LogEverything.DebugLogCategory 0 (disable debug output)"));
+				LE_LOG_DEBUG(LELogTestLogSystem, TEXT("Current LogEverything.Debug.LogCategory = {}"),
+				             FLEDecisionTracer::IsEnabled() ? TEXT("true") : TEXT("false"));
+				LE_LOG_DEBUG(LELogTestLogSystem, TEXT("Run command: LogEverything.Debug.LogCategory 1 (enable debug output)"));
+				LE_LOG_DEBUG(LELogTestLogSystem, TEXT("Run command: LogEverything.Debug.LogCategory 0 (disable debug output)"));
 				LE_LOG_DEBUG(LELogTestLogSystem, TEXT(""));
 
 				// === Summary ===
@@ -138,12 +189,302 @@ namespace LogEverything
 				LE_LOG_DEBUG(LELogTestLogSystem, TEXT("Key takeaways:"));
 				LE_LOG_DEBUG(LELogTestLogSystem, TEXT("1. Successfully changed Test.LogSystem from Verbose -> Log"));
 				LE_LOG_DEBUG(LELogTestLogSystem, TEXT("2. Verified Verbose logs are blocked after lowering the level"));
-				LE_LOG_DEBUG(LELogTestLogSystem, TEXT("3. Demonstrated CVar LogEverything.DebugLogCategory controlling debug output"));
+				LE_LOG_DEBUG(LELogTestLogSystem, TEXT("3. Demonstrated CVar LogEverything.Debug.LogCategory controlling debug output"));
 				LE_LOG_DEBUG(LELogTestLogSystem, TEXT("4. Used ULELogSubsystem API for runtime log configuration"));
 				LE_LOG_DEBUG(LELogTestLogSystem, TEXT(""));
 			})
 		);
 
+		/**
+		 * LE.Test.CategoryRules - Tests pattern rule compilation on a standalone tree core
+		 * Covers single/multi component wildcards, disable rules, auto-apply to new categories and rule removal
+		 */
+		static FAutoConsoleCommand TestCategoryRulesCommand(
+			TEXT("LE.Test.CategoryRules"),
+			TEXT("Test LogEverything category pattern rules against a standalone category tree"),
+			FConsoleCommandDelegate::CreateLambda([]() {
+				FLECategoryTreeCore TreeCore;
+				TreeCore.InitializeTree({ TEXT("Game.Player.Input"), TEXT("Game.UI.Input"), TEXT("Game.AI.Pathfinding"),
+					TEXT("Test.LogSystem"), TEXT("Engine.Render") });
+
+				TArray<FLECategoryRule> Rules;
+				FLECategoryRule::ParseList(TEXT("Game.*.Input=Warning; **.Pathfinding=Verbose; !Test.**"), Rules);
+				TreeCore.SetCategoryRules(Rules);
+
+				FLETestChecks Checks(TEXT("LE.Test.CategoryRules"));
+				auto ExpectLevel = [&TreeCore, &Checks](const TCHAR* Path, ELELogVerbosity Expected)
+				{
+					const ELELogVerbosity Actual = TreeCore.GetEffectiveLevel(Path);
+					if (Actual != Expected)
+					{
+						Checks.Fail(*FString::Printf(TEXT("%s: expected %s, got %s"), Path, LELogVerbosityUtils::ToString(Expected), LELogVerbosityUtils::ToString(Actual)));
+					}
+				};
+				auto ExpectEnabled = [&TreeCore, &Checks](const TCHAR* Path, bool bExpected)
+				{
+					if (TreeCore.IsCategoryEnabled(Path) != bExpected)
+					{
+						Checks.Fail(*FString::Printf(TEXT("%s: expected enabled=%s"), Path, bExpected ? TEXT("true") : TEXT("false")));
+					}
+				};
+
+				// 规则编译
+				ExpectLevel(TEXT("Game.Player.Input"), ELELogVerbosity::Warning);
+				ExpectLevel(TEXT("Game.UI.Input"), ELELogVerbosity::Warning);
+				ExpectLevel(TEXT("Game.AI.Pathfinding"), ELELogVerbosity::Verbose);
+				ExpectLevel(TEXT("Game.AI"), ELELogVerbosity::Info);
+				ExpectLevel(TEXT("Engine.Render"), ELELogVerbosity::Info);
+				ExpectEnabled(TEXT("Test"), false);
+				ExpectEnabled(TEXT("Test.LogSystem"), false);
+				ExpectEnabled(TEXT("Engine"), true);
+
+				// 新分类出现时自动套用
+				TreeCore.RegisterCategories(TArray<FString>{ TEXT("Game.Vehicle.Input"), TEXT("Test.Network") });
+				ExpectLevel(TEXT("Game.Vehicle.Input"), ELELogVerbosity::Warning);
+				ExpectEnabled(TEXT("Test.Network"), false);
+
+				// 手动设置优先，清除规则后恢复继承
+				TreeCore.SetCategoryLevel(TEXT("Game.UI.Input"), ELELogVerbosity::Error);
+				TreeCore.SetCategoryRules(TArray<FLECategoryRule>());
+				ExpectLevel(TEXT("Game.Player.Input"), ELELogVerbosity::Info);
+				ExpectLevel(TEXT("Game.UI.Input"), ELELogVerbosity::Error);
+				ExpectEnabled(TEXT("Test.LogSystem"), true);
+
+				Checks.Report();
+			})
+		);
+
+		/**
+		 * LE.Test.InheritedEnable - Tests inherited enable/disable on a standalone tree core
+		 * Disabling a parent must silence its subtree and re-enabling must restore each child's own state
+		 */
+		static FAutoConsoleCommand TestInheritedEnableCommand(
+			TEXT("LE.Test.InheritedEnable"),
+			TEXT("Test LogEverything inherited enable/disable semantics against a standalone category tree"),
+			FConsoleCommandDelegate::CreateLambda([]() {
+				FLECategoryTreeCore TreeCore;
+				TreeCore.InitializeTree({ TEXT("Game.AI.Pathfinding"), TEXT("Game.AI.Perception"), TEXT("Game.Combat") });
+
+				FLETestChecks Checks(TEXT("LE.Test.InheritedEnable"));
+
+				// 子节点自己关闭，父节点关闭再打开后仍保持关闭
+				TreeCore.SetCategoryEnabled(TEXT("Game.AI.Perception"), false);
+				TreeCore.SetCategoryEnabled(TEXT("Game.AI"), false);
+				Checks.Expect(TEXT("Game.AI.Pathfinding inherits disable"), !TreeCore.IsCategoryEnabled(TEXT("Game.AI.Pathfinding")));
+				Checks.Expect(TEXT("Game.AI.Pathfinding filtered"), !TreeCore.ShouldLogCategory(FName(TEXT("Game.AI.Pathfinding")), ELELogVerbosity::Fatal));
+				Checks.Expect(TEXT("Game.Combat unaffected"), TreeCore.IsCategoryEnabled(TEXT("Game.Combat")));
+
+				FLECategoryNode PathfindingNode;
+				TreeCore.GetCategoryNode(TEXT("Game.AI.Pathfinding"), PathfindingNode);
+				Checks.Expect(TEXT("Game.AI.Pathfinding keeps its own flag"), PathfindingNode.bIsEnabled && !PathfindingNode.bIsEffectivelyEnabled);
+
+				TreeCore.SetCategoryEnabled(TEXT("Game.AI"), true);
+				Checks.Expect(TEXT("Game.AI.Pathfinding restored"), TreeCore.IsCategoryEnabled(TEXT("Game.AI.Pathfinding")));
+				Checks.Expect(TEXT("Game.AI.Perception stays disabled"), !TreeCore.IsCategoryEnabled(TEXT("Game.AI.Perception")));
+
+				// 禁用状态下新建的子分类同样被禁用
+				TreeCore.SetCategoryEnabled(TEXT("Game"), false);
+				TreeCore.RegisterCategories(TArray<FString>{ TEXT("Game.AI.Navigation") });
+				Checks.Expect(TEXT("new Game.AI.Navigation inherits disable"), !TreeCore.IsCategoryEnabled(TEXT("Game.AI.Navigation")));
+				TreeCore.SetCategoryEnabled(TEXT("Game"), true);
+				Checks.Expect(TEXT("Game.AI.Navigation restored"), TreeCore.IsCategoryEnabled(TEXT("Game.AI.Navigation")));
+
+				Checks.Report();
+			})
+		);
+
+		/**
+		 * LE.Test.ScopedVerbosity - Tests thread-scoped verbosity overrides
+		 * Overrides must cover the whole subtree, nest innermost-first, and stay invisible to other threads
+		 */
+		static FAutoConsoleCommand TestScopedVerbosityCommand(
+			TEXT("LE.Test.ScopedVerbosity"),
+			TEXT("Test LogEverything thread-scoped verbosity overrides (LE_SCOPED_VERBOSITY)"),
+			FConsoleCommandDelegate::CreateLambda([]() {
+				FLETestChecks Checks(TEXT("LE.Test.ScopedVerbosity"));
+
+				const uint32 AIIndex = decltype(LELogGameAI)::CategoryIndex;
+				const uint32 PathfindingIndex = decltype(LELogGameAIPathfinding)::CategoryIndex;
+				const uint32 CombatIndex = decltype(LELogGameCombat)::CategoryIndex;
+
+				FLELogCallSite CallSite;
+				ELELogVerbosity OverrideLevel;
+				Checks.Expect(TEXT("no override outside scope"), !FLEScopedVerbosity::FindOverride(PathfindingIndex, OverrideLevel));
+				{
+					LE_SCOPED_VERBOSITY(LELogGameAI, Verbose);
+					Checks.Expect(TEXT("Game.AI overridden"), FLEScopedVerbosity::FindOverride(AIIndex, OverrideLevel) && OverrideLevel == ELELogVerbosity::Verbose);
+					Checks.Expect(TEXT("Game.AI.Pathfinding covered by subtree"), FLEScopedVerbosity::FindOverride(PathfindingIndex, OverrideLevel));
+					Checks.Expect(TEXT("Game.Combat not covered"), !FLEScopedVerbosity::FindOverride(CombatIndex, OverrideLevel));
+					Checks.Expect(TEXT("Game.AI.Pathfinding Verbose passes gate"), ULogEverythingUtils::ShouldLogCallSite(CallSite, PathfindingIndex, ELELogVerbosity::Verbose));
+
+					{
+						LE_SCOPED_VERBOSITY(LELogGameAIPathfinding, NoLogging);
+						Checks.Expect(TEXT("inner override silences Game.AI.Pathfinding"), !ULogEverythingUtils::ShouldLogCallSite(CallSite, PathfindingIndex, ELELogVerbosity::Fatal));
+						Checks.Expect(TEXT("Game.AI keeps outer override"), ULogEverythingUtils::ShouldLogCallSite(CallSite, AIIndex, ELELogVerbosity::Verbose));
+					}
+
+					const bool bOtherThreadSees = Async(EAsyncExecution::Thread, [PathfindingIndex]()
+					{
+						ELELogVerbosity OtherLevel;
+						return FLEScopedVerbosity::FindOverride(PathfindingIndex, OtherLevel);
+					}).Get();
+					Checks.Expect(TEXT("other threads unaffected"), !bOtherThreadSees);
+				}
+				Checks.Expect(TEXT("override popped at scope exit"), !FLEScopedVerbosity::FindOverride(AIIndex, OverrideLevel));
+
+				Checks.Report();
+			})
+		);
+
+		/**
+		 * LE.Test.ObjectWatchList - Tests the LE_LOG_OBJ watch list and its bloom-filtered lookup
+		 * Uses entity IDs far outside the UObject index range and restores the previous watch list
+		 */
+		static FAutoConsoleCommand TestObjectWatchListCommand(
+			TEXT("LE.Test.ObjectWatchList"),
+			TEXT("Test LogEverything per-object watch list membership (LE_LOG_OBJ)"),
+			FConsoleCommandDelegate::CreateLambda([]() {
+				FLETestChecks Checks(TEXT("LE.Test.ObjectWatchList"));
+
+				const TArray<uint64> PreviousIds = FLEObjectWatchList::GetWatchedIds();
+				FLEObjectWatchList::Clear();
+
+				const uint64 WatchedId = 0xABCD000000000001ull;
+				Checks.Expect(TEXT("empty list rejects"), !FLEObjectWatchList::IsWatched(WatchedId));
+				Checks.Expect(TEXT("watch new id"), FLEObjectWatchList::WatchId(WatchedId));
+				Checks.Expect(TEXT("duplicate watch rejected"), !FLEObjectWatchList::WatchId(WatchedId));
+				Checks.Expect(TEXT("watched id found"), FLEObjectWatchList::IsWatched(WatchedId));
+
+				// 布隆误判只会落到精确查找，结果必须仍为未观察
+				int32 NumFalseMatches = 0;
+				for (uint64 Id = 1; Id <= 10000; ++Id)
+				{
+					NumFalseMatches += FLEObjectWatchList::IsWatched(WatchedId + Id) ? 1 : 0;
+				}
+				Checks.Expect(TEXT("unwatched ids rejected"), NumFalseMatches == 0);
+
+				LE_LOG_OBJ(WatchedId, LELogTestLogSystem, Verbose, TEXT("LE_LOG_OBJ emitted for watched entity {}"), WatchedId);
+
+				Checks.Expect(TEXT("unwatch id"), FLEObjectWatchList::UnwatchId(WatchedId));
+				Checks.Expect(TEXT("unwatched id rejected"), !FLEObjectWatchList::IsWatched(WatchedId));
+
+				for (const uint64 Id : PreviousIds)
+				{
+					FLEObjectWatchList::WatchId(Id);
+				}
+
+				Checks.Report();
+			})
+		);
+
+		/**
+		 * LE.Test.BqLogConfig - Tests the FLELogSettings to BqLog config generator
+		 * Checks appender/thread mode mapping, validation, and ToString/Parse round-trips
+		 */
+		static FAutoConsoleCommand TestBqLogConfigCommand(
+			TEXT("LE.Test.BqLogConfig"),
+			TEXT("Test LogEverything BqLog configuration generation, validation and round-trip parsing"),
+			FConsoleCommandDelegate::CreateLambda([]() {
+				FLETestChecks Checks(TEXT("LE.Test.BqLogConfig"));
+				auto RoundTrips = [](const FLEBqLogConfig& Config)
+				{
+					FLEBqLogConfig Parsed;
+					return FLEBqLogConfig::Parse(Config.ToString(), Parsed) && Parsed == Config && Parsed.ToString() == Config.ToString();
+				};
+
+				// 默认设置：控制台 + 文本文件，异步，按 MaxLogFileSizeMB 滚动
+				FLELogSettings Settings;
+				FLEBqLogConfig Config = FLEBqLogConfig::FromSettings(Settings, TEXT("/Saved/LogEverything/LE_1"));
+				Checks.Expect(TEXT("default config valid"), Config.Validate());
+				Checks.Expect(TEXT("default thread mode async"), Config.ThreadMode == TEXT("async"));
+				Checks.Expect(TEXT("default buffer size"), Config.BufferSize == Settings.BufferSize);
+				Checks.Expect(TEXT("default appenders"), Config.Appenders.Num() == 2
+					&& Config.Appenders[0].Type == TEXT("console") && Config.Appenders[1].Type == TEXT("text_file"));
+				Checks.Expect(TEXT("max file size in bytes"), Config.Appenders.Num() == 2 && Config.Appenders[1].MaxFileSize == 100ll * 1024 * 1024);
+				Checks.Expect(TEXT("default round-trip"), RoundTrips(Config));
+
+				// 压缩 + 原始二进制 + 网络（无对应 appender），同步 / 独立线程
+				Settings.OutputTargets = { ELELogOutput::File, ELELogOutput::Compressed, ELELogOutput::Raw, ELELogOutput::Network };
+				Settings.bEnableCompression = true;
+				Settings.bEnableAsyncLogging = false;
+				Config = FLEBqLogConfig::FromSettings(Settings, TEXT("/Saved/Logs/Game_1"));
+				Checks.Expect(TEXT("compressed file deduplicated"), Config.Appenders.Num() == 2
+					&& Config.Appenders[0].Type == TEXT("compressed_file") && Config.Appenders[1].Type == TEXT("raw_file"));
+				Checks.Expect(TEXT("sync thread mode"), Config.ThreadMode == TEXT("sync"));
+				Settings.bEnableAsyncLogging = true;
+				Settings.bUseIndependentLogThread = true;
+				Config = FLEBqLogConfig::FromSettings(Settings, TEXT("/Saved/Logs/Game_1"));
+				Checks.Expect(TEXT("independent thread mode"), Config.ThreadMode == TEXT("independent"));
+				Config.SetLevels(TEXT("[warning,error,fatal]"));
+				Config.CategoriesMask = TEXT("[*default,Game.AI]");
+				Checks.Expect(TEXT("filtered round-trip"), Config.Validate() && RoundTrips(Config));
+
+				// 校验失败的配置
+				FLEBqLogConfig Invalid = Config;
+				Invalid.BufferSize = 16;
+				Checks.Expect(TEXT("tiny buffer rejected"), !Invalid.Validate());
+				Invalid = Config;
+				Invalid.Appenders.Reset();
+				Checks.Expect(TEXT("no appenders rejected"), !Invalid.Validate());
+				Invalid = Config;
+				Invalid.Appenders[0].FileName.Reset();
+				TArray<FString> Errors;
+				Checks.Expect(TEXT("missing file name rejected"), !Invalid.Validate(&Errors) && Errors.Num() == 1);
+				FLEBqLogConfig Parsed;
+				Checks.Expect(TEXT("malformed line rejected"), !FLEBqLogConfig::Parse(TEXT("log.thread_mode"), Parsed));
+
+				Checks.Report();
+			})
+		);
+
+		/**
+		 * LE.Test.ReliabilityPolicy - Tests the per-level reliability policy
+		 * Checks defaults, policy text parsing and the reliable_level config key
+		 */
+		static FAutoConsoleCommand TestReliabilityPolicyCommand(
+			TEXT("LE.Test.ReliabilityPolicy"),
+			TEXT("Test LogEverything reliability policy defaults, parsing and BqLog reliable_level generation"),
+			FConsoleCommandDelegate::CreateLambda([]() {
+				FLETestChecks Checks(TEXT("LE.Test.ReliabilityPolicy"));
+
+				// 默认：Verbose/Debug/Info 丢弃，Warning 短暂阻塞，Error/Fatal 走高可靠路径
+				FLELogReliabilityPolicy Policy;
+				Checks.Expect(TEXT("verbose drops"), Policy.GetForLevel(ELELogVerbosity::Verbose) == ELELogReliability::Drop);
+				Checks.Expect(TEXT("info drops"), Policy.GetForLevel(ELELogVerbosity::Info) == ELELogReliability::Drop);
+				Checks.Expect(TEXT("warning blocks"), Policy.GetForLevel(ELELogVerbosity::Warning) == ELELogReliability::Block);
+				Checks.Expect(TEXT("error guaranteed"), Policy.GetForLevel(ELELogVerbosity::Error) == ELELogReliability::Guaranteed);
+				Checks.Expect(TEXT("no logging drops"), Policy.GetForLevel(ELELogVerbosity::NoLogging) == ELELogReliability::Drop);
+				Checks.Expect(TEXT("default needs reliable logger"), Policy.RequiresGuaranteedLogger());
+
+				// 部分覆盖：未提及的级别保持原值，大小写不敏感
+				Checks.Expect(TEXT("partial policy parsed"), FLELogReliabilityPolicy::Parse(TEXT("info=block; Error=Block, Fatal=Block BlockTimeoutMs=20"), Policy));
+				Checks.Expect(TEXT("info overridden"), Policy.Info == ELELogReliability::Block);
+				Checks.Expect(TEXT("warning kept"), Policy.Warning == ELELogReliability::Block);
+				Checks.Expect(TEXT("timeout parsed"), Policy.BlockTimeoutMs == 20);
+				Checks.Expect(TEXT("no guaranteed level"), !Policy.RequiresGuaranteedLogger());
+
+				FLELogReliabilityPolicy RoundTrip;
+				Checks.Expect(TEXT("policy round-trip"), FLELogReliabilityPolicy::Parse(Policy.ToString(), RoundTrip) && RoundTrip.ToString() == Policy.ToString());
+
+				// 无效条目被跳过，其余条目仍然生效
+				FLELogReliabilityPolicy Invalid;
+				Checks.Expect(TEXT("unknown mode rejected"), !FLELogReliabilityPolicy::Parse(TEXT("Warning=Maybe,Debug=Block"), Invalid));
+				Checks.Expect(TEXT("valid entry still applied"), Invalid.Warning == ELELogReliability::Block && Invalid.Debug == ELELogReliability::Block);
+				Checks.Expect(TEXT("off level rejected"), !FLELogReliabilityPolicy::Parse(TEXT("Off=Drop"), Invalid));
+				Checks.Expect(TEXT("bad timeout rejected"), !FLELogReliabilityPolicy::Parse(TEXT("BlockTimeoutMs=soon"), Invalid));
+
+				// log.reliable_level 的生成、解析与校验
+				FLEBqLogConfig Config = FLEBqLogConfig::FromSettings(FLELogSettings(), TEXT("/Saved/LogEverything/LE_1"));
+				Config.ReliableLevel = TEXT("high");
+				FLEBqLogConfig Parsed;
+				Checks.Expect(TEXT("reliable_level round-trip"), FLEBqLogConfig::Parse(Config.ToString(), Parsed) && Parsed == Config);
+				Config.ReliableLevel = TEXT("paranoid");
+				Checks.Expect(TEXT("invalid reliable_level rejected"), !Config.Validate());
+
+				Checks.Report();
+			})
+		);
+
 		// =============================================================================
 		// Debug utility commands
 		// =============================================================================
@@ -209,6 +550,286 @@ namespace LogEverything
 					*CategoryName, (int32)EffectiveLevel, *UEnum::GetValueAsString(EffectiveLevel));
 			})
 		);
+
+		/**
+		 * LE.Debug.DumpDecisionTrace [MaxRecentPerThread] - Dumps the filtering decision trace
+		 * Output goes through UE_LOG so dumping never re-enters the LE logging pipeline
+		 */
+		static FAutoConsoleCommand DumpDecisionTraceCommand(
+			TEXT("LE.Debug.DumpDecisionTrace"),
+			TEXT("Dump per-category decision counters and recent sampled decisions per thread\nUsage: LE.Debug.DumpDecisionTrace [MaxRecentPerThread]\nEnable tracing with: LogEverything.Debug.LogCategory 1"),
+			FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+				const int32 MaxRecentPerThread = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 16;
+
+				TArray<FString> Lines;
+				FLEDecisionTracer::ExportDebugString(MaxRecentPerThread).ParseIntoArrayLines(Lines);
+				for (const FString& Line : Lines)
+				{
+					LE_SYSTEM_LOG(TEXT("%s"), *Line);
+				}
+			})
+		);
+
+		/**
+		 * LE.Debug.ResetDecisionTrace - Clears decision counters and trace rings
+		 */
+		static FAutoConsoleCommand ResetDecisionTraceCommand(
+			TEXT("LE.Debug.ResetDecisionTrace"),
+			TEXT("Clear LogEverything decision trace counters and per-thread rings"),
+			FConsoleCommandDelegate::CreateLambda([]() {
+				FLEDecisionTracer::Reset();
+				LE_SYSTEM_LOG(TEXT("Decision trace reset"));
+			})
+		);
+
+		/** 解析观察目标：纯数字视为实体 ID，否则按对象名称 / 路径查找 UObject */
+		static const UObject* FindWatchTarget(const FString& Target, uint64& OutEntityId)
+		{
+			OutEntityId = 0;
+			if (FCString::IsNumeric(*Target))
+			{
+				OutEntityId = FCString::Strtoui64(*Target, nullptr, 10);
+				return nullptr;
+			}
+			return StaticFindFirstObject(UObject::StaticClass(), *Target, EFindFirstObjectOptions::None);
+		}
+
+		/**
+		 * LE.Debug.WatchObject <ObjectNameOrEntityId> - Adds an object or entity to the LE_LOG_OBJ watch list
+		 * Watched objects emit LE_LOG_OBJ messages even below their category threshold
+		 */
+		static FAutoConsoleCommand WatchObjectCommand(
+			TEXT("LE.Debug.WatchObject"),
+			TEXT("Watch an object or entity so its LE_LOG_OBJ messages bypass the category threshold\nUsage: LE.Debug.WatchObject <ObjectNameOrEntityId>"),
+			FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+				if (Args.Num() == 0)
+				{
+					LE_SYSTEM_WARNING(TEXT("Usage: LE.Debug.WatchObject <ObjectNameOrEntityId>"));
+					return;
+				}
+
+				uint64 EntityId = 0;
+				const UObject* Object = FindWatchTarget(Args[0], EntityId);
+				if (Object)
+				{
+					FLEObjectWatchList::WatchObject(Object);
+					LE_SYSTEM_LOG(TEXT("Watching object %s (id %llu)"), *Object->GetPathName(), FLEObjectWatchList::GetObjectId(Object));
+				}
+				else if (EntityId != 0)
+				{
+					FLEObjectWatchList::WatchId(EntityId);
+					LE_SYSTEM_LOG(TEXT("Watching entity %llu"), EntityId);
+				}
+				else
+				{
+					LE_SYSTEM_WARNING(TEXT("No object or entity found for '%s'"), *Args[0]);
+				}
+			})
+		);
+
+		/**
+		 * LE.Debug.UnwatchObject <ObjectNameOrEntityId> - Removes an object or entity from the watch list
+		 */
+		static FAutoConsoleCommand UnwatchObjectCommand(
+			TEXT("LE.Debug.UnwatchObject"),
+			TEXT("Stop watching an object or entity\nUsage: LE.Debug.UnwatchObject <ObjectNameOrEntityId>"),
+			FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+				if (Args.Num() == 0)
+				{
+					LE_SYSTEM_WARNING(TEXT("Usage: LE.Debug.UnwatchObject <ObjectNameOrEntityId>"));
+					return;
+				}
+
+				uint64 EntityId = 0;
+				const UObject* Object = FindWatchTarget(Args[0], EntityId);
+				const bool bRemoved = Object ? FLEObjectWatchList::UnwatchObject(Object) : FLEObjectWatchList::UnwatchId(EntityId);
+				LE_SYSTEM_LOG(TEXT("%s '%s'"), bRemoved ? TEXT("Stopped watching") : TEXT("Not watched:"), *Args[0]);
+			})
+		);
+
+		/**
+		 * LE.Debug.ListWatchedObjects - Lists watched object/entity IDs
+		 */
+		static FAutoConsoleCommand ListWatchedObjectsCommand(
+			TEXT("LE.Debug.ListWatchedObjects"),
+			TEXT("List object and entity IDs on the LE_LOG_OBJ watch list"),
+			FConsoleCommandDelegate::CreateLambda([]() {
+				const TArray<uint64> Ids = FLEObjectWatchList::GetWatchedIds();
+				LE_SYSTEM_LOG(TEXT("%d watched ids"), Ids.Num());
+				for (const uint64 Id : Ids)
+				{
+					// UObject ID 的高 32 位为序列号，低 32 位为对象索引
+					LE_SYSTEM_LOG(TEXT("  %llu (serial %u, index %u)"), Id, static_cast<uint32>(Id >> 32), static_cast<uint32>(Id));
+				}
+			})
+		);
+
+		/**
+		 * LE.Debug.ClearWatchList - Clears the object watch list
+		 */
+		static FAutoConsoleCommand ClearWatchListCommand(
+			TEXT("LE.Debug.ClearWatchList"),
+			TEXT("Clear the LE_LOG_OBJ watch list"),
+			FConsoleCommandDelegate::CreateLambda([]() {
+				FLEObjectWatchList::Clear();
+				LE_SYSTEM_LOG(TEXT("Watch list cleared"));
+			})
+		);
+
+		/**
+		 * LE.Debug.DroppedEntries [reset] - Prints entries dropped because the BqLog buffer was full
+		 * Breaks the total down by category and level, largest first
+		 */
+		static FAutoConsoleCommand DroppedEntriesCommand(
+			TEXT("LE.Debug.DroppedEntries"),
+			TEXT("Print log entries dropped because the BqLog buffer was full, by category and level\nUsage: LE.Debug.DroppedEntries [reset]"),
+			FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+				ULELogSubsystem* LogSubsystem = ULELogSubsystem::Get(nullptr);
+				if (!LogSubsystem)
+				{
+					LE_SYSTEM_ERROR(TEXT("Unable to acquire ULELogSubsystem instance!"));
+					return;
+				}
+
+				// 输出使用系统日志：写入 BqLog 本身可能正是丢失的原因
+				const TArray<FLEDroppedEntryStat> Stats = LogSubsystem->GetDroppedEntryStats();
+				LE_SYSTEM_LOG(TEXT("%lld entries dropped"), LogSubsystem->GetDroppedEntryCount());
+				for (const FLEDroppedEntryStat& Stat : Stats)
+				{
+					LE_SYSTEM_LOG(TEXT("  %-40s %-8s %lld"), *Stat.Category.ToString(), LELogVerbosityUtils::ToString(Stat.Level), Stat.Count);
+				}
+
+				if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+				{
+					LogSubsystem->ResetDroppedEntryStats();
+				}
+			})
+		);
+
+		/**
+		 * LE.Debug.PrintRoutes - Prints the log routes and the resolved per-category routing table
+		 * Only categories with at least one routed level are listed
+		 */
+		static FAutoConsoleCommand PrintRoutesCommand(
+			TEXT("LE.Debug.PrintRoutes"),
+			TEXT("Print LogEverything log routes and which route each category and level resolves to"),
+			FConsoleCommandDelegate::CreateLambda([]() {
+				FLEBqLogBridge& Bridge = FLEBqLogBridge::Get();
+				const TArray<FLELogRoute> Routes = Bridge.GetRoutes();
+				LE_SYSTEM_LOG(TEXT("%d routes configured"), Routes.Num());
+				for (const FLELogRoute& Route : Routes)
+				{
+					LE_SYSTEM_LOG(TEXT("  %s: [%s] %s..%s, buffer %d"), *Route.Name.ToString(),
+						Route.Categories.IsEmpty() ? TEXT("**") : *FString::Join(Route.Categories, TEXT(",")),
+						LELogVerbosityUtils::ToString(Route.MinLevel), LELogVerbosityUtils::ToString(Route.MaxLevel), Route.BufferSize);
+				}
+
+				for (int32 BqIndex = 0; BqIndex < LogEverythingGenerated::CategoryCount; ++BqIndex)
+				{
+					TStringBuilder<256> Line;
+					bool bRouted = false;
+					for (uint8 Level = 0; Level <= static_cast<uint8>(ELELogVerbosity::Fatal); ++Level)
+					{
+						const int32 RouteIndex = Bridge.GetResolvedRoute(BqIndex, static_cast<ELELogVerbosity>(Level));
+						bRouted |= Routes.IsValidIndex(RouteIndex);
+						Line.Appendf(TEXT(" %s=%s"), LELogVerbosityUtils::ToString(static_cast<ELELogVerbosity>(Level)),
+							Routes.IsValidIndex(RouteIndex) ? *Routes[RouteIndex].Name.ToString() : TEXT("main"));
+					}
+					if (bRouted)
+					{
+						LE_SYSTEM_LOG(TEXT("  %s:%s"), LogEverythingGenerated::CategoryFullNames[BqIndex], Line.ToString());
+					}
+				}
+			})
+		);
+
+		// =============================================================================
+		// Benchmark commands
+		// =============================================================================
+
+		/**
+		 * LE.Bench.CategoryInsertion [Count] - Benchmarks dynamic category insertion
+		 * Inserts synthetic paths into a standalone tree core, so the live tree is untouched
+		 */
+		static FAutoConsoleCommand BenchCategoryInsertionCommand(
+			TEXT("LE.Bench.CategoryInsertion"),
+			TEXT("Insert synthetic category paths into a standalone category tree and report time and memory\nUsage: LE.Bench.CategoryInsertion [Count=100000]"),
+			FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+				const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100000;
+
+				// 路径在计时前生成：1000 个叶子一个模块，每个模块 100 个系统，共享前缀可以测出逐级查找的开销
+				TArray<FString> Paths;
+				Paths.Reserve(Count);
+				for (int32 Index = 0; Index < Count; ++Index)
+				{
+					Paths.Add(FString::Printf(TEXT("Bench.Mod%d.System%d.Leaf%d"), Index / 1000, (Index / 10) % 100, Index));
+				}
+
+				const FPlatformMemoryStats StatsBefore = FPlatformMemory::GetStats();
+				FLECategoryTreeCore TreeCore;
+				TreeCore.InitializeTree(TArray<FString>());
+
+				const double InsertStart = FPlatformTime::Seconds();
+				const int32 NumCreated = TreeCore.RegisterCategories(Paths);
+				const double InsertSeconds = FPlatformTime::Seconds() - InsertStart;
+
+				// 再插入一遍：全部命中已有节点，只走完整路径查找
+				const double LookupStart = FPlatformTime::Seconds();
+				TreeCore.RegisterCategories(Paths);
+				const double LookupSeconds = FPlatformTime::Seconds() - LookupStart;
+
+				const FPlatformMemoryStats StatsAfter = FPlatformMemory::GetStats();
+				const double UsedDeltaMB = (static_cast<double>(StatsAfter.UsedPhysical) - static_cast<double>(StatsBefore.UsedPhysical)) / (1024.0 * 1024.0);
+
+				LE_SYSTEM_LOG(TEXT("CategoryInsertion: %d paths, %d new nodes"), Count, NumCreated);
+				LE_SYSTEM_LOG(TEXT("  Insert: %.2f ms (%.1f ns/path)"), InsertSeconds * 1000.0, InsertSeconds * 1e9 / Count);
+				LE_SYSTEM_LOG(TEXT("  Re-register: %.2f ms (%.1f ns/path)"), LookupSeconds * 1000.0, LookupSeconds * 1e9 / Count);
+				LE_SYSTEM_LOG(TEXT("  Tree allocated: %.2f MB, process used delta: %.2f MB, process peak: %.2f MB"),
+					TreeCore.GetAllocatedSize() / (1024.0 * 1024.0), UsedDeltaMB, StatsAfter.PeakUsedPhysical / (1024.0 * 1024.0));
+			})
+		);
+
+		/**
+		 * LE.Bench.CategoryTransaction [Count] - Benchmarks applying a batched level profile
+		 * Uses a standalone tree core; the tree version delta shows how many times the filter table was published
+		 */
+		static FAutoConsoleCommand BenchCategoryTransactionCommand(
+			TEXT("LE.Bench.CategoryTransaction"),
+			TEXT("Apply a synthetic level profile as one transaction to a standalone category tree and report the cost\nUsage: LE.Bench.CategoryTransaction [Count=2000]"),
+			FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+				const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 2000;
+
+				TArray<FString> Paths;
+				Paths.Reserve(Count);
+				for (int32 Index = 0; Index < Count; ++Index)
+				{
+					Paths.Add(FString::Printf(TEXT("Bench.Mod%d.System%d.Leaf%d"), Index / 100, (Index / 10) % 10, Index));
+				}
+
+				FLECategoryTreeCore TreeCore;
+				TreeCore.InitializeTree(TArray<FString>());
+				TreeCore.RegisterCategories(Paths);
+
+				// 模拟 QA 级别配置：叶子级别轮换，每个模块再带一条强制传播的启用修改
+				FLECategoryTreeTransaction Transaction;
+				Transaction.Reserve(Count + Count / 100 + 1);
+				for (int32 Index = 0; Index < Count; ++Index)
+				{
+					Transaction.SetCategoryLevel(Paths[Index], static_cast<ELELogVerbosity>(Index % 5));
+				}
+				for (int32 ModuleIndex = 0; ModuleIndex <= (Count - 1) / 100; ++ModuleIndex)
+				{
+					Transaction.SetCategoryEnabled(FString::Printf(TEXT("Bench.Mod%d"), ModuleIndex), ModuleIndex % 2 == 0, true);
+				}
+
+				const int32 VersionBefore = TreeCore.GetTreeVersion();
+				const double ApplyStart = FPlatformTime::Seconds();
+				const int32 NumApplied = TreeCore.ApplyTransaction(Transaction);
+				const double ApplySeconds = FPlatformTime::Seconds() - ApplyStart;
+
+				LE_SYSTEM_LOG(TEXT("CategoryTransaction: %d changes applied over %d categories"), NumApplied, Count);
+				LE_SYSTEM_LOG(TEXT("  Apply: %.1f us, tree version delta: %d"), ApplySeconds * 1e6, TreeCore.GetTreeVersion() - VersionBefore);
+			})
+		);
 	}
 }
-
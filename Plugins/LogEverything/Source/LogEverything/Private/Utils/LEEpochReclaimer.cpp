@@ -0,0 +1,194 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Utils/LEEpochReclaimer.h"
+#include "Misc/ScopeLock.h"
+
+namespace LogEverything
+{
+	namespace Private
+	{
+		/** 空闲槽位的纪元值 */
+		static constexpr uint64 IdleEpoch = 0;
+
+		/** 按缓存行对齐的读者槽位，避免读者之间的伪共享 */
+		struct alignas(PLATFORM_CACHE_LINE_SIZE) FLEReaderSlot
+		{
+			std::atomic<uint64> Epoch{ IdleEpoch };
+			std::atomic<bool> bOwned{ false };
+		};
+
+		struct FLERetiredObject
+		{
+			void* Object;
+			void (*Deleter)(void*);
+			uint64 RetireEpoch;
+		};
+
+		/** 全局纪元，从 1 开始（0 表示空闲槽位） */
+		static std::atomic<uint64> GlobalEpoch{ 1 };
+
+		static FLEReaderSlot ReaderSlots[FLEEpochReclaimer::MaxReaderSlots];
+
+		/** 未能分配到槽位的读者数 */
+		static std::atomic<int32> OverflowReaders{ 0 };
+
+		static FCriticalSection& GetRetiredLock()
+		{
+			static FCriticalSection RetiredLock;
+			return RetiredLock;
+		}
+
+		static TArray<FLERetiredObject>& GetRetiredObjects()
+		{
+			static TArray<FLERetiredObject> RetiredObjects;
+			return RetiredObjects;
+		}
+
+		/** 线程槽位句柄，线程退出时归还槽位 */
+		struct FLEThreadReaderState
+		{
+			int32 SlotIndex = INDEX_NONE;
+			int32 Depth = 0;
+			bool bUsingOverflow = false;
+
+			FLEThreadReaderState()
+			{
+				for (int32 Index = 0; Index < FLEEpochReclaimer::MaxReaderSlots; ++Index)
+				{
+					bool bExpected = false;
+					if (!ReaderSlots[Index].bOwned.load(std::memory_order_relaxed)
+						&& ReaderSlots[Index].bOwned.compare_exchange_strong(bExpected, true, std::memory_order_acquire))
+					{
+						SlotIndex = Index;
+						break;
+					}
+				}
+			}
+
+			~FLEThreadReaderState()
+			{
+				if (SlotIndex != INDEX_NONE)
+				{
+					ReaderSlots[SlotIndex].Epoch.store(IdleEpoch, std::memory_order_release);
+					ReaderSlots[SlotIndex].bOwned.store(false, std::memory_order_release);
+				}
+			}
+		};
+
+		static FLEThreadReaderState& GetThreadReaderState()
+		{
+			static thread_local FLEThreadReaderState ThreadState;
+			return ThreadState;
+		}
+	}
+}
+
+void FLEEpochReclaimer::EnterRead()
+{
+	using namespace LogEverything::Private;
+
+	FLEThreadReaderState& State = GetThreadReaderState();
+	if (State.Depth++ > 0)
+	{
+		return;
+	}
+
+	if (State.SlotIndex != INDEX_NONE)
+	{
+		// 公布纪元必须先于读取发布指针（seq_cst 保证与写者的替换/扫描全序）
+		ReaderSlots[State.SlotIndex].Epoch.store(GlobalEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+	}
+	else
+	{
+		State.bUsingOverflow = true;
+		OverflowReaders.fetch_add(1, std::memory_order_seq_cst);
+	}
+}
+
+void FLEEpochReclaimer::ExitRead()
+{
+	using namespace LogEverything::Private;
+
+	FLEThreadReaderState& State = GetThreadReaderState();
+	if (--State.Depth > 0)
+	{
+		return;
+	}
+
+	if (State.bUsingOverflow)
+	{
+		State.bUsingOverflow = false;
+		OverflowReaders.fetch_sub(1, std::memory_order_release);
+	}
+	else
+	{
+		ReaderSlots[State.SlotIndex].Epoch.store(IdleEpoch, std::memory_order_release);
+	}
+}
+
+void FLEEpochReclaimer::Retire(void* Object, void (*Deleter)(void*))
+{
+	using namespace LogEverything::Private;
+
+	if (!Object)
+	{
+		return;
+	}
+
+	// 调用方已完成指针替换：此后进入的读者公布的纪元必然大于 RetireEpoch，看不到旧对象
+	const uint64 RetireEpoch = GlobalEpoch.fetch_add(1, std::memory_order_seq_cst);
+	{
+		FScopeLock Lock(&GetRetiredLock());
+		GetRetiredObjects().Add({ Object, Deleter, RetireEpoch });
+	}
+
+	Reclaim();
+}
+
+void FLEEpochReclaimer::Reclaim()
+{
+	using namespace LogEverything::Private;
+
+	if (OverflowReaders.load(std::memory_order_seq_cst) > 0)
+	{
+		return;
+	}
+
+	// 所有活跃读者中最早公布的纪元
+	uint64 MinActiveEpoch = TNumericLimits<uint64>::Max();
+	for (const FLEReaderSlot& Slot : ReaderSlots)
+	{
+		const uint64 SlotEpoch = Slot.Epoch.load(std::memory_order_seq_cst);
+		if (SlotEpoch != IdleEpoch)
+		{
+			MinActiveEpoch = FMath::Min(MinActiveEpoch, SlotEpoch);
+		}
+	}
+
+	TArray<FLERetiredObject> Reclaimable;
+	{
+		FScopeLock Lock(&GetRetiredLock());
+		TArray<FLERetiredObject>& RetiredObjects = GetRetiredObjects();
+		for (int32 Index = RetiredObjects.Num() - 1; Index >= 0; --Index)
+		{
+			if (RetiredObjects[Index].RetireEpoch < MinActiveEpoch)
+			{
+				Reclaimable.Add(RetiredObjects[Index]);
+				RetiredObjects.RemoveAtSwap(Index, 1, false);
+			}
+		}
+	}
+
+	for (const FLERetiredObject& Retired : Reclaimable)
+	{
+		Retired.Deleter(Retired.Object);
+	}
+}
+
+int32 FLEEpochReclaimer::GetNumPendingRetired()
+{
+	using namespace LogEverything::Private;
+
+	FScopeLock Lock(&GetRetiredLock());
+	return GetRetiredObjects().Num();
+}
@@ -3,6 +3,8 @@
 #include "Utils/LogEverythingUtils.h"
 #include "System/LELogSubsystem.h"
 #include "System/LELogTypes.h"
+#include "System/LEDecisionTracer.h"
+#include "System/LEFilterState.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 
@@ -67,6 +69,29 @@ bool ULogEverythingUtils::IsCategoryEnabled(const UObject* WorldContext, const F
 	return LogSubsystem->IsCategoryEnabled(CategoryPath);
 }
 
+bool ULogEverythingUtils::SetCategoryRules(const UObject* WorldContext, const TArray<FString>& Rules)
+{
+	ULELogSubsystem* LogSubsystem = GetLogSubsystem(WorldContext);
+	if (!LogSubsystem)
+	{
+		LE_SYSTEM_WARNING(TEXT("LogSubsystem not available for SetCategoryRules"));
+		return false;
+	}
+
+	return LogSubsystem->SetCategoryRules(Rules);
+}
+
+TArray<FString> ULogEverythingUtils::GetCategoryRules(const UObject* WorldContext)
+{
+	ULELogSubsystem* LogSubsystem = GetLogSubsystem(WorldContext);
+	if (!LogSubsystem)
+	{
+		return TArray<FString>();
+	}
+
+	return LogSubsystem->GetCategoryRules();
+}
+
 TArray<FString> ULogEverythingUtils::GetAllCategoryPaths(const UObject* WorldContext)
 {
 	ULELogSubsystem* LogSubsystem = GetLogSubsystem(WorldContext);
@@ -200,4 +225,49 @@ ULELogSubsystem* ULogEverythingUtils::GetLogSubsystem(const UObject* WorldContex
 	}
 
 	return ULELogSubsystem::Get(WorldContext);
-}
\ No newline at end of file
+}
+
+bool ULogEverythingUtils::ResolveCallSite(FLELogCallSite& CallSite, uint32 CategoryIndex, ELELogVerbosity Level)
+{
+	// 先读取纪元再计算：若计算期间纪元再次变化，写回的旧纪元会在下一次调用时失配并重新计算
+	const uint32 Epoch = LogEverything::GCallSiteEpoch.load(std::memory_order_acquire);
+
+	bool bDecision = false;
+	FLEBqLogBridge& Bridge = FLEBqLogBridge::Get();
+	if (Bridge.IsNativeFilteringEnabled())
+	{
+		// 原生过滤模式：分类与级别过滤交给 BqLog，仅在其无法精确表达时查桥接层字节表
+		bDecision = Bridge.ShouldLogNative(CategoryIndex, Level);
+	}
+	else
+	{
+		// 进程级过滤状态从模块加载起即有效，GameInstance 出现前使用引导快照
+		bDecision = FLEFilterState::ShouldLog(CategoryIndex, Level);
+	}
+
+	CallSite.PackedState.store(FLELogCallSite::Pack(Epoch, CategoryIndex, bDecision), std::memory_order_relaxed);
+
+	// 决策追踪只在慢路径上检查，稳态命中缓存的调用不受影响
+	if (FLEDecisionTracer::IsEnabled())
+	{
+		FLEDecisionTracer::Record(static_cast<int32>(CategoryIndex), Level, bDecision);
+	}
+	return bDecision;
+}
+
+bool ULogEverythingUtils::IsCategoryEffectivelyEnabled(uint32 CategoryIndex)
+{
+	ELELogVerbosity OverrideLevel;
+	if (FLEScopedVerbosity::AnyActive() && FLEScopedVerbosity::FindOverride(CategoryIndex, OverrideLevel))
+	{
+		return OverrideLevel != ELELogVerbosity::NoLogging;
+	}
+
+	// 过滤字节中禁用的分类为 NoLogging，其余不高于 Fatal，因此 Fatal 能否通过即为启用状态
+	FLEBqLogBridge& Bridge = FLEBqLogBridge::Get();
+	if (Bridge.IsNativeFilteringEnabled())
+	{
+		return Bridge.ShouldLogNative(CategoryIndex, ELELogVerbosity::Fatal);
+	}
+	return FLEFilterState::ShouldLog(CategoryIndex, ELELogVerbosity::Fatal);
+}
@@ -4,17 +4,81 @@
 
 #include "CoreMinimal.h"
 #include "System/LELogTypes.h"
+#include "Bridge/LEBqLogConfig.h"
+#include "System/LEDropCounters.h"
+#include "Category/LECategoryTreeCore.h"
+#include "Utils/LEEpochReclaimer.h"
 #include "Engine/Engine.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
 #include "Generated/LogEverythingLogger.h"
+#include "Generated/LogEverythingCategoryTables.h"
 
 class ULELogSubsystem;
 
 // BqLog 前向声明
 namespace bq {
 	class LogEverythingLogger;
-	enum class log_level : int;
 }
 
+namespace LogEverything
+{
+	namespace Private
+	{
+		/**
+		 * 发射参数类型归一化：数组（字符串字面量）退化为指针，使不同长度的字面量共享同一个发射实例
+		 */
+		template<typename T>
+		struct TEmitArg
+		{
+			using Type = T;
+		};
+
+		template<typename T, SIZE_T N>
+		struct TEmitArg<T[N]>
+		{
+			using Type = const T*;
+		};
+
+		/**
+		 * 访问 bq::log::do_log / is_enable_for 的辅助类（从不实例化）
+		 * 通过派生类取得受保护成员函数的成员指针，从而按分类索引写入，避免按分类结构体实例化
+		 */
+		struct FBqLogAccess : public bq::log
+		{
+			/** 级别与分类掩码检查（do_log 的返回值无法区分"被过滤"与"缓冲区已满"） */
+			FORCEINLINE static bool IsEnableFor(const bq::log& Logger, uint32 CategoryIndex, bq::log_level Level)
+			{
+				using FIsEnableForFunc = bool (bq::log::*)(uint32_t, bq::log_level) const;
+				constexpr FIsEnableForFunc IsEnableForFunc = &FBqLogAccess::is_enable_for;
+				return (Logger.*IsEnableForFunc)(CategoryIndex, Level);
+			}
+
+			template<typename FormatType, typename... Args>
+			FORCEINLINE static bool DoLog(const bq::log& Logger, uint32 CategoryIndex, bq::log_level Level,
+				const FormatType& Format, const Args&... Arguments)
+			{
+				using FDoLogFunc = bool (bq::log::*)(uint32_t, bq::log_level, const FormatType&, const Args&...) const;
+				constexpr FDoLogFunc DoLogFunc = &FBqLogAccess::do_log<FormatType, Args...>;
+				return (Logger.*DoLogFunc)(CategoryIndex, Level, Format, Arguments...);
+			}
+		};
+	}
+}
+
+/**
+ * 由分类树编译出的原生过滤输入
+ * Native filter input compiled from the category tree
+ */
+struct FLENativeCategoryFilter
+{
+	/** 按 BqLog 分类索引排列的过滤字节（允许输出的最低级别，禁用为 NoLogging） */
+	TArray<uint8> FilterBytes;
+
+	/** 每个 BqLog 分类的父分类索引（顶层分类为 0，根分类为 INDEX_NONE） */
+	TArray<int32> ParentIndices;
+};
+
 /**
  * BqLog 与 Unreal Engine 的桥接类
  * Bridge class between BqLog and Unreal Engine logging system
@@ -22,6 +86,9 @@ namespace bq {
 class LOGEVERYTHING_API FLEBqLogBridge
 {
 public:
+	/** 路由 logger 的最大数量（路由表中 0 表示主 logger，1..MaxRoutes 表示路由） */
+	static constexpr int32 MaxRoutes = 7;
+
 	/** 构造函数 */
 	FLEBqLogBridge();
 
@@ -34,9 +101,46 @@ public:
 	/** 关闭 BqLog 系统 */
 	void Shutdown();
 
+	/**
+	 * 运行时重新配置 BqLog（例如对局之间切换 appender 或缓冲区大小）
+	 * 能通过 reset_config 修改的配置原地应用；线程模式或缓冲区大小变化时创建新的 logger 并原子切换，
+	 * 旧 logger 刷新后保留，切换瞬间仍在写入它的日志不会丢失
+	 * @return 新配置是否生效
+	 */
+	bool Reconfigure(const FLELogSettings& Settings);
+
 	/** 是否已初始化 */
 	bool IsInitialized() const { return bIsInitialized; }
 
+	/**
+	 * 设置缓冲区写满时的可靠性策略（任意时刻可调用，发射路径通过原子变量读取）
+	 * 有级别使用 Guaranteed 时按需创建高可靠 logger
+	 * @return 策略是否完整生效（高可靠 logger 创建失败时 Guaranteed 退化为 Block）
+	 */
+	bool SetReliabilityPolicy(const FLELogReliabilityPolicy& Policy);
+
+	/** 获取当前可靠性策略 */
+	FLELogReliabilityPolicy GetReliabilityPolicy() const;
+
+	/**
+	 * 设置路由表：为每条路由创建或更新独立的 logger，并把路由解析为按分类与级别的查找表
+	 * 超出 MaxRoutes 或配置无效的路由被忽略，其日志留在主 logger
+	 * @return 是否所有路由都已生效
+	 */
+	bool SetRoutes(const TArray<FLELogRoute>& Routes);
+
+	/** 获取当前路由表 */
+	TArray<FLELogRoute> GetRoutes() const;
+
+	/**
+	 * 获取分类与级别解析后的路由
+	 * @return 路由在 GetRoutes() 中的下标，留在主 logger 时为 INDEX_NONE
+	 */
+	int32 GetResolvedRoute(uint32 CategoryIndex, ELELogVerbosity Level) const;
+
+	/** 因缓冲区写满而丢失的日志条数（Guaranteed 副本已写入的不计），按分类与级别的明细见 FLEDropCounters */
+	uint64 GetDroppedEntryCount() const;
+
 	/** 获取单例实例 */
 	static FLEBqLogBridge& Get();
 
@@ -50,15 +154,68 @@ public:
 
 	ULELogSubsystem* GetLogSubsystem() const { return LogSystemPtr.Get(); }
 
+	/** 设置过滤模式，切回 CategoryTree 时恢复 BqLog 全开配置 */
+	void SetFilterMode(ELEFilterMode InFilterMode);
+
+	/** 是否处于 BqLog 原生过滤模式 */
+	FORCEINLINE bool IsNativeFilteringEnabled() const { return bNativeFiltering.load(std::memory_order_relaxed); }
+
+	/**
+	 * 原生过滤模式下的分类级别检查
+	 * BqLog 每个 log 只有一张合并后的级别位图，当各分类阈值不一致时无法精确表达，
+	 * 此时用桥接层自己的字节表补充判断；能够精确表达时直接交给 BqLog 的 is_enable_for
+	 */
+	FORCEINLINE bool ShouldLogNative(uint32 BqCategoryIndex, ELELogVerbosity Level) const
+	{
+		if (bNativeFilterExact.load(std::memory_order_relaxed))
+		{
+			return true;
+		}
+
+		// 任意线程可调用：在纪元读区内读取不可变的原生过滤表
+		FLEEpochReadScope ReadScope;
+		const FLECategoryFilterSnapshot* Snapshot = NativeFilterSnapshot.load(std::memory_order_seq_cst);
+		if (Snapshot && BqCategoryIndex < static_cast<uint32>(Snapshot->FilterBytes.Num()))
+		{
+			return static_cast<uint8>(Level) >= Snapshot->FilterBytes.GetData()[BqCategoryIndex];
+		}
+		return true;
+	}
+
+	/** 将分类树状态编译为 BqLog 分类掩码与级别位图，并通过 reset_config 应用 */
+	void ApplyNativeCategoryFilter(const FLENativeCategoryFilter& Filter);
+
+	/**
+	 * 放宽原生过滤：BqLog 改为全开，分类阈值改由调用点查字节表判断
+	 * 观察列表非空时由 FLEObjectWatchList 开启，使低于阈值的观察对象日志不会被 BqLog 的 is_enable_for 拦截
+	 */
+	void SetNativeFilterRelaxed(bool bRelaxed);
+
 	/** 高性能模板日志函数 - 直接调用 BqLog 模板接口，避免字符串预格式化
 	 * 使用 LE Category 对象，纯粹的BqLog交互桥梁
+	 * 本身只做参数类型归一化并转发到 EmitLog，调用点只内联这一层跳转
 	 * @param Category  声明的分类对象 (如 LogGameCombatSkill)
 	 * @param Level     LogEverything 日志级别
 	 * @param Format    格式化字符串
 	 * @param Args      格式化参数
 	 */
 	template<typename CategoryType, typename FormatType, typename... Args>
-	void LogWithTemplate(const CategoryType& Category, ELELogVerbosity Level, const FormatType& Format, const Args&... Arguments);
+	FORCEINLINE void LogWithTemplate(const CategoryType& Category, ELELogVerbosity Level, const FormatType& Format, const Args&... Arguments)
+	{
+		EmitLog<typename LogEverything::Private::TEmitArg<FormatType>::Type, typename LogEverything::Private::TEmitArg<Args>::Type...>(
+			CategoryType::CategoryIndex, Level, Format, Arguments...);
+	}
+
+	/**
+	 * 冷路径发射函数 - 按参数类型签名实例化，不内联
+	 * 所有分类与级别共享同一个实例，BqLog 的大小计算、缓冲区分配、参数填充与提交都只在这里展开一次
+	 * @param CategoryIndex BqLog 分类索引
+	 * @param Level     LogEverything 日志级别
+	 * @param Format    格式化字符串（字面量已退化为指针）
+	 * @param Arguments 格式化参数
+	 */
+	template<typename FormatType, typename... Args>
+	FORCENOINLINE void EmitLog(uint32 CategoryIndex, ELELogVerbosity Level, const FormatType& Format, const Args&... Arguments);
 
 public:
 	/** UTF-8 与 UTF-16 转换函数 */
@@ -66,8 +223,57 @@ public:
 	static TArray<uint8> FStringToUTF8(const FString& InString);
 
 private:
-	/** BqLog Category Log 实例 */
-	bq::LogEverythingLogger* CategoryLogInstance;
+	/** 一路 BqLog logger：当前实例与它的所有历代句柄 */
+	struct FLoggerSlot
+	{
+		/** logger 名称前缀，第 N 代为 <BaseName>_N（按槽位固定，路由改名不会让两个槽位撞上同一个 BqLog 实例） */
+		FString BaseName;
+
+		/** 当前实例（发射路径上只 load 一次），未创建或已关闭时为空 */
+		std::atomic<bq::LogEverythingLogger*> Instance{ nullptr };
+
+		/**
+		 * 创建过的所有 logger 句柄，最后一个为当前或可复用的实例
+		 * BqLog 不支持销毁 logger，且切换后可能仍有线程持有旧指针，因此句柄在桥接层生命周期内不释放
+		 */
+		TArray<TUniquePtr<bq::LogEverythingLogger>> Handles;
+
+		/** 最后一个 logger 创建时的配置（决定之后能否通过 reset_config 原地修改） */
+		FLEBqLogConfig CreationConfig;
+	};
+
+	/** 主 logger（reliable_level=low，缓冲区写满时由桥接层按策略重试或丢弃） */
+	FLoggerSlot MainLogger;
+
+	/** 高可靠 logger（reliable_level=high，mmap 缓冲），只接收 Guaranteed 级别的副本 */
+	FLoggerSlot ReliableLogger;
+
+	/** 路由 logger（各自的缓冲区与独立工作线程），未使用的槽位实例为空 */
+	FLoggerSlot RouteLoggers[MaxRoutes];
+
+	/** 各路由 logger 的基础配置（appender、线程模式、缓冲区），级别与掩码与主 logger 一致 */
+	FLEBqLogConfig RouteBaseConfigs[MaxRoutes];
+
+	/** 每个级别的槽位数（Verbose .. Fatal） */
+	static constexpr int32 NumLevels = static_cast<int32>(ELELogVerbosity::Fatal) + 1;
+
+	/**
+	 * 路由查找表：按 [BqLog 分类索引 * NumLevels + 级别] 排列，值为路由槽位 + 1，0 表示主 logger
+	 * BqLog 分类在编译期固定，设置路由时一次性解析，发射路径上只多一次字节读取
+	 */
+	std::atomic<uint8> RouteTable[LogEverythingGenerated::CategoryCount * NumLevels];
+
+	/** 路由槽位对应的 CurrentSettings.Routes 下标（被忽略的路由不占槽位），只在锁内访问 */
+	int32 RouteSlotToIndex[MaxRoutes];
+
+	/** 每个级别的可靠性策略（下标为 ELELogVerbosity，值为 ELELogReliability） */
+	std::atomic<uint8> LevelReliability[static_cast<uint8>(ELELogVerbosity::Fatal) + 1];
+
+	/** Block 策略的最长等待时间（CPU 周期） */
+	std::atomic<uint64> BlockTimeoutCycles;
+
+	/** 下一次允许写入丢失汇总日志的时间（CPU 周期） */
+	std::atomic<uint64> NextDropSummaryCycles;
 
 	/** 初始化状态 */
 	bool bIsInitialized;
@@ -77,12 +283,39 @@ private:
 	/** 当前配置 */
 	FLELogSettings CurrentSettings;
 
+	/** 日志文件绝对路径（不含扩展名） */
+	FString AbsoluteLogPath;
+
+	/** 由设置生成的基础配置（appender、线程模式、缓冲区），级别与掩码在构建字符串时填入 */
+	FLEBqLogConfig BaseConfig;
+
+	/** 是否处于原生过滤模式 */
+	std::atomic<bool> bNativeFiltering;
+
+	/** 原生过滤是否能由 BqLog 掩码与级别位图精确表达（放宽期间为 false） */
+	std::atomic<bool> bNativeFilterExact;
+
+	/** 最近一次编译出的过滤表本身是否精确（不考虑放宽） */
+	std::atomic<bool> bNativeFilterCompiledExact;
+
+	/** 是否因观察列表放宽了原生过滤，只在锁内访问 */
+	bool bNativeFilterRelaxed;
+
+	/** 原生过滤模式下的分类过滤字节表（仅在无法精确表达时使用） */
+	std::atomic<const FLECategoryFilterSnapshot*> NativeFilterSnapshot;
+
+	/** 替换原生过滤表快照，旧快照交给纪元回收器 */
+	void PublishNativeFilterSnapshot(const FLECategoryFilterSnapshot* NewSnapshot);
+
+	/** 当前应用到 BqLog 的 appender 级别列表 */
+	FString NativeLevelsConfig;
+
+	/** 当前应用到 BqLog 的分类掩码 */
+	FString NativeCategoriesMaskConfig;
+
 	/** 线程安全锁 */
 	mutable FCriticalSection CriticalSection;
 
-	/** 单例实例 */
-	static FLEBqLogBridge* Instance;
-
 private:
 	/** 不允许拷贝 */
 	FLEBqLogBridge(const FLEBqLogBridge&) = delete;
@@ -90,51 +323,136 @@ private:
 
 	/** 初始化 BqLog 配置 */
 	bool SetupBqLogConfig(const FLELogSettings& Settings);
-	
+
+	/** 根据当前级别列表与分类掩码构建主 logger 的 BqLog 配置字符串 */
+	FString BuildBqLogConfigString() const;
+
+	/** 通过 reset_config 把当前级别列表与分类掩码应用到主 logger 与所有路由 logger */
+	bool ResetBqLogConfig();
+
+	/**
+	 * 复用现有 logger（reset_config）或创建新 logger 并切换
+	 * @param Slot 目标 logger
+	 * @param Config 已校验的完整配置
+	 */
+	bool CreateOrUpdateLogger(FLoggerSlot& Slot, const FLEBqLogConfig& Config);
+
+	/** 按当前策略创建、更新或停用高可靠 logger（需持有锁） */
+	bool UpdateReliableLogger();
+
+	/** 按当前路由表创建、更新或停用路由 logger，并发布路由查找表（需持有锁） */
+	bool UpdateRouteLoggers();
+
+	/** 在基础配置上填入当前原生过滤的级别列表与分类掩码 */
+	FLEBqLogConfig ApplyNativeFilterConfig(const FLEBqLogConfig& Config) const;
+
+	/** 按分类与级别选择目标 logger（路由 logger 未就绪时回退到主 logger），主 logger 未创建时返回空 */
+	FORCEINLINE const bq::LogEverythingLogger* SelectLogger(uint32 CategoryIndex, ELELogVerbosity Level) const
+	{
+		const bq::LogEverythingLogger* Logger = MainLogger.Instance.load(std::memory_order_acquire);
+		if (Logger && CategoryIndex < static_cast<uint32>(LogEverythingGenerated::CategoryCount))
+		{
+			const uint8 Route = RouteTable[CategoryIndex * NumLevels + static_cast<uint8>(Level)].load(std::memory_order_relaxed);
+			if (Route != 0)
+			{
+				if (const bq::LogEverythingLogger* RouteLogger = RouteLoggers[Route - 1].Instance.load(std::memory_order_acquire))
+				{
+					return RouteLogger;
+				}
+			}
+		}
+		return Logger;
+	}
+
+	/** 将策略发布到发射路径读取的原子变量 */
+	void PublishReliabilityPolicy(const FLELogReliabilityPolicy& Policy);
+
+	/** 记录一条丢失的日志 */
+	FORCENOINLINE void OnEntryDropped(uint32 CategoryIndex, ELELogVerbosity Level);
+
+	/**
+	 * 缓冲区恢复后写入一条"丢失 N 条日志"的汇总（每秒最多一次）
+	 * 优先写入根分类的 warning；根分类被原生过滤拦截时写入刚刚成功的分类与级别
+	 */
+	FORCENOINLINE void WriteDropSummary(const bq::LogEverythingLogger& Logger, uint32 CategoryIndex, bq::log_level Level);
+
 };
 
 // 模板函数实现
 
-template<typename CategoryType, typename FormatType, typename... Args>
-void FLEBqLogBridge::LogWithTemplate(const CategoryType& Category, ELELogVerbosity Level, const FormatType& Format, const Args&... Arguments)
+template<typename FormatType, typename... Args>
+FORCENOINLINE void FLEBqLogBridge::EmitLog(uint32 CategoryIndex, ELELogVerbosity Level, const FormatType& Format, const Args&... Arguments)
 {
-	// 检查 BqLog 实例是否有效
-	if (!bIsInitialized || !CategoryLogInstance)
+	using LogEverything::Private::FBqLogAccess;
+
+	// NoLogging级别不输出任何内容，其他未知级别默认使用info
+	if (Level == ELELogVerbosity::NoLogging)
 	{
 		return;
 	}
+	if (static_cast<uint8>(Level) > static_cast<uint8>(ELELogVerbosity::Fatal))
+	{
+		Level = ELELogVerbosity::Info;
+	}
+	const bq::log_level BqLevel = static_cast<bq::log_level>(Level);
 
-	// 获取分类句柄
-	auto CategoryHandle = Category.GetCategoryHandle(*CategoryLogInstance);
+	// 只读取一次实例指针：重新创建 logger 时旧实例不会被释放，已读到旧指针的写入依然有效
+	const bq::LogEverythingLogger* Logger = SelectLogger(CategoryIndex, Level);
+	if (!Logger)
+	{
+		return;
+	}
 
-	// 根据LogEverything日志级别调用相应的 BqLog 模板方法
-	switch (Level)
+	// 被 BqLog 级别或分类掩码过滤的日志不是丢失，直接返回
+	if (!FBqLogAccess::IsEnableFor(*Logger, CategoryIndex, BqLevel))
 	{
-	case ELELogVerbosity::Fatal:
-		(void)CategoryLogInstance->fatal(CategoryHandle, Format, Arguments...);
-		break;
-	case ELELogVerbosity::Error:
-		(void)CategoryLogInstance->error(CategoryHandle, Format, Arguments...);
-		break;
-	case ELELogVerbosity::Warning:
-		(void)CategoryLogInstance->warning(CategoryHandle, Format, Arguments...);
-		break;
-	case ELELogVerbosity::Info:
-		(void)CategoryLogInstance->info(CategoryHandle, Format, Arguments...);
-		break;
-	case ELELogVerbosity::Debug:
-		(void)CategoryLogInstance->debug(CategoryHandle, Format, Arguments...);
-		break;
-	case ELELogVerbosity::Verbose:
-		(void)CategoryLogInstance->verbose(CategoryHandle, Format, Arguments...);
-		break;
-	case ELELogVerbosity::NoLogging:
-	default:
-		// NoLogging级别不输出任何内容，其他未知级别默认使用info
-		if (Level != ELELogVerbosity::NoLogging)
+		return;
+	}
+
+	const ELELogReliability Reliability = static_cast<ELELogReliability>(LevelReliability[static_cast<uint8>(Level)].load(std::memory_order_relaxed));
+
+	// Guaranteed：先写入高可靠 logger（缓冲区满时阻塞，崩溃后可由 mmap 恢复），该条目从此不会丢失
+	bool bSecured = false;
+	if (Reliability == ELELogReliability::Guaranteed)
+	{
+		if (const bq::LogEverythingLogger* Reliable = ReliableLogger.Instance.load(std::memory_order_acquire))
 		{
-			(void)CategoryLogInstance->info(CategoryHandle, Format, Arguments...);
+			bSecured = FBqLogAccess::DoLog(*Reliable, CategoryIndex, BqLevel, Format, Arguments...);
 		}
-		break;
 	}
-}
\ No newline at end of file
+
+	if (LIKELY(FBqLogAccess::DoLog(*Logger, CategoryIndex, BqLevel, Format, Arguments...)))
+	{
+		// 写入成功说明缓冲区有空间，顺带报告之前丢失的日志
+		if (UNLIKELY(FLEDropCounters::HasUnreported()))
+		{
+			WriteDropSummary(*Logger, CategoryIndex, BqLevel);
+		}
+		return;
+	}
+
+	// 主缓冲区已满：Drop 立即放弃；Block 与未能写入高可靠 logger 的 Guaranteed 让出时间片等待工作线程腾出空间，最长 BlockTimeout
+	// 已写入高可靠 logger 的条目不会丢失，不再让调用线程等待
+	if (Reliability != ELELogReliability::Drop && !bSecured)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		const uint64 TimeoutCycles = BlockTimeoutCycles.load(std::memory_order_relaxed);
+		while (FPlatformTime::Cycles64() - StartCycles < TimeoutCycles)
+		{
+			FPlatformProcess::YieldThread();
+			if (FBqLogAccess::DoLog(*Logger, CategoryIndex, BqLevel, Format, Arguments...))
+			{
+				if (UNLIKELY(FLEDropCounters::HasUnreported()))
+				{
+					WriteDropSummary(*Logger, CategoryIndex, BqLevel);
+				}
+				return;
+			}
+		}
+	}
+
+	if (!bSecured)
+	{
+		OnEntryDropped(CategoryIndex, Level);
+	}
+}
@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "System/LELogTypes.h"
+
+/**
+ * BqLog appender 配置
+ * One "appenders_config.<Name>.*" block of a BqLog configuration
+ */
+struct LOGEVERYTHING_API FLEBqLogAppenderConfig
+{
+	/** appender 名称（配置键中的 <Name>） */
+	FString Name;
+
+	/** appender 类型：console / text_file / raw_file / compressed_file */
+	FString Type;
+
+	/** 文件路径（不含扩展名，BqLog 按类型追加扩展名与时间戳），console 为空 */
+	FString FileName;
+
+	/** 单个文件的最大字节数，超出后滚动到新文件；0 表示不限制 */
+	int64 MaxFileSize = 0;
+
+	/** 级别列表，如 "[all]" 或 "[warning,error,fatal]" */
+	FString Levels = TEXT("[all]");
+
+	/** 是否为文件类 appender */
+	bool IsFileAppender() const;
+
+	bool operator==(const FLEBqLogAppenderConfig& Other) const
+	{
+		return Name == Other.Name && Type == Other.Type && FileName == Other.FileName
+			&& MaxFileSize == Other.MaxFileSize && Levels == Other.Levels;
+	}
+};
+
+/**
+ * BqLog 配置生成器
+ * Maps FLELogSettings onto a BqLog properties configuration and back
+ *
+ * - OutputTargets: Console → console，File → text_file（bEnableCompression 时为 compressed_file），
+ *   Compressed → compressed_file，Raw → raw_file；Network 没有对应的 BqLog appender，生成时跳过并警告
+ * - BufferSize → log.buffer_size，bEnableAsyncLogging / bUseIndependentLogThread → log.thread_mode
+ * - MaxLogFileSizeMB → 各文件 appender 的 max_file_size
+ * - log.reliable_level 由桥接层按可靠性策略填入（主 logger 为 low，高可靠 logger 为 high）
+ * - 级别列表与分类掩码由桥接层按过滤模式填入（见 FLEBqLogBridge）
+ *
+ * ToString 与 Parse 互逆，可用于校验与往返测试
+ */
+struct LOGEVERYTHING_API FLEBqLogConfig
+{
+	/** log.thread_mode：sync / async / independent */
+	FString ThreadMode = TEXT("async");
+
+	/** log.buffer_size（字节），0 表示使用 BqLog 默认值 */
+	int32 BufferSize = 0;
+
+	/** log.categories_mask */
+	FString CategoriesMask = TEXT("all");
+
+	/** log.reliable_level：low / normal / high，空表示使用 BqLog 默认值 */
+	FString ReliableLevel;
+
+	/** appender 列表（按输出顺序） */
+	TArray<FLEBqLogAppenderConfig> Appenders;
+
+	/**
+	 * 由日志设置生成配置
+	 * @param Settings 日志设置
+	 * @param FileBasePath 文件类 appender 使用的绝对路径（不含扩展名）
+	 */
+	static FLEBqLogConfig FromSettings(const FLELogSettings& Settings, const FString& FileBasePath);
+
+	/** 为所有 appender 设置同一级别列表 */
+	void SetLevels(const FString& Levels);
+
+	/**
+	 * 校验配置
+	 * @param OutErrors 可选，输出所有错误描述
+	 * @return 是否有效
+	 */
+	bool Validate(TArray<FString>* OutErrors = nullptr) const;
+
+	/** 生成 BqLog 配置文本（每行一个 key=value） */
+	FString ToString() const;
+
+	/**
+	 * 解析 BqLog 配置文本（只识别本生成器输出的键，未知键被忽略）
+	 * @return 语法是否有效
+	 */
+	static bool Parse(FStringView ConfigText, FLEBqLogConfig& OutConfig);
+
+	bool operator==(const FLEBqLogConfig& Other) const
+	{
+		return ThreadMode == Other.ThreadMode && BufferSize == Other.BufferSize
+			&& CategoriesMask == Other.CategoriesMask && ReliableLevel == Other.ReliableLevel && Appenders == Other.Appenders;
+	}
+};
@@ -0,0 +1,58 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "System/LELogTypes.h"
+
+/**
+ * 分类级别规则 - 按通配模式批量设置分类级别或禁用分类
+ * Pattern-based category rule, e.g. "Game.*.Input=Warning", "**.Pathfinding=Verbose", "!Test.**"
+ *
+ * 模式按点分为组件，锚定完整路径：
+ * - "*" / "?" 在单个组件内匹配任意字符序列 / 单个字符（"*" 恰好匹配一个组件）
+ * - "**" 作为整个组件时匹配零个或多个组件
+ * - 前缀 "!" 表示禁用匹配的分类，否则需要 "=级别"
+ *
+ * 规则只在设置时对整棵树编译一次（见 FLECategoryTreeCore::SetCategoryRules），热路径上不做模式匹配
+ */
+struct LOGEVERYTHING_API FLECategoryRule
+{
+	/** 模式文本（不含 "!" 与 "=级别"） */
+	FString Pattern;
+
+	/** 匹配分类的显式级别（禁用规则忽略） */
+	ELELogVerbosity Level = ELELogVerbosity::Info;
+
+	/** 是否为禁用规则 */
+	bool bDisable = false;
+
+	/**
+	 * 解析单条规则
+	 * @param RuleText 规则文本，如 "Game.*.Input=Warning" 或 "!Test.**"
+	 * @param OutRule 输出的规则
+	 * @return 语法是否有效
+	 */
+	static bool Parse(FStringView RuleText, FLECategoryRule& OutRule);
+
+	/**
+	 * 解析规则列表（以分号、逗号或空白分隔），无效规则会被跳过并输出警告
+	 * @param RulesText 规则列表文本
+	 * @param OutRules 输出的规则（保持原顺序）
+	 * @return 是否所有规则都有效
+	 */
+	static bool ParseList(FStringView RulesText, TArray<FLECategoryRule>& OutRules);
+
+	/**
+	 * 检查分类路径是否匹配（大小写不敏感，与 FName 一致）
+	 * @param CategoryPath 分类完整路径（如 "Game.Combat.Skill"）
+	 */
+	bool Matches(FStringView CategoryPath) const;
+
+	/** 转换回规则文本 */
+	FString ToString() const;
+
+private:
+	/** 按点拆分后的模式组件 */
+	TArray<FString> PatternComponents;
+};
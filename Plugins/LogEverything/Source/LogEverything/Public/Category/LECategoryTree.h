@@ -7,14 +7,15 @@
 #include "Engine/Engine.h"
 #include "Logging/LogVerbosity.h"
 #include "System/LELogTypes.h"
+#include "Category/LECategoryTreeCore.h"
 #include "LECategoryTree.generated.h"
 
 /**
- * 日志分类节点结构体 - 轻量级USTRUCT实现
- * Log category node structure - lightweight USTRUCT implementation
+ * 日志分类节点视图 - 轻量级USTRUCT实现
+ * Log category node view - lightweight USTRUCT
  *
- * 用于构建树状的分类级别管理系统，支持智能继承和高效查询
- * Used to build tree-based category level management system with smart inheritance and efficient queries
+ * 分类树内部按结构数组（SoA）存储，本结构体只在 UI / 蓝图 / 调试需要时按需生成，修改它不会影响分类树
+ * The tree stores its data as structure-of-arrays; this struct is a read-only copy produced on demand
  */
 USTRUCT(BlueprintType)
 struct LOGEVERYTHING_API FLECategoryNode
@@ -43,15 +44,19 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Level")
 	bool bHasExplicitLevel;
 
-	/** 是否启用该分类 */
+	/** 该分类自身的启用开关 */
 	UPROPERTY(BlueprintReadOnly, Category = "Level")
 	bool bIsEnabled;
 
+	/** 有效启用状态（自身与所有祖先都启用时才为 true） */
+	UPROPERTY(BlueprintReadOnly, Category = "Level")
+	bool bIsEffectivelyEnabled;
+
 	/** 父节点在数组中的索引 */
 	UPROPERTY(BlueprintReadOnly, Category = "Structure")
 	int32 ParentIndex;
 
-	/** 子节点在数组中的索引列表 */
+	/** 子节点在数组中的索引列表（生成视图时从首子/兄弟链展开） */
 	UPROPERTY(BlueprintReadOnly, Category = "Structure")
 	TArray<int32> ChildIndices;
 
@@ -59,6 +64,17 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Structure")
 	int32 Depth;
 
+	/**
+	 * 子树结束索引（不包含）：节点按深度优先前序存储，子树即 [自身索引 + 1, SubtreeEnd)
+	 * Exclusive end of this node's subtree; nodes are stored in depth-first pre-order
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Structure")
+	int32 SubtreeEnd;
+
+	/** 对应的 BqLog 分类索引（CAT_INDEX），运行时动态创建的节点为 INDEX_NONE */
+	UPROPERTY(BlueprintReadOnly, Category = "Structure")
+	int32 BqCategoryIndex;
+
 public:
 
 	FLECategoryNode()
@@ -67,74 +83,13 @@ public:
 	, EffectiveLevel(ELELogVerbosity::Info)
 	, bHasExplicitLevel(false)
 	, bIsEnabled(true)
+	, bIsEffectivelyEnabled(true)
 	, ParentIndex(INDEX_NONE)
 	, Depth(0)
+	, SubtreeEnd(INDEX_NONE)
+	, BqCategoryIndex(INDEX_NONE)
 	{
 	}
-	/**
-	 * 设置显式日志级别
-	 * @param Level 要设置的级别
-	 * @param bUpdateEffective 是否同时更新有效级别
-	 */
-	void SetExplicitLevel(ELELogVerbosity Level, bool bUpdateEffective = true)
-	{
-		ExplicitLevel = Level;
-		bHasExplicitLevel = true;
-		if (bUpdateEffective)
-		{
-			EffectiveLevel = Level;
-		}
-	}
-
-	/**
-	 * 清除显式级别设置
-	 * @param InheritedLevel 从父节点继承的级别
-	 */
-	void ClearExplicitLevel(ELELogVerbosity InheritedLevel = ELELogVerbosity::Info)
-	{
-		bHasExplicitLevel = false;
-		ExplicitLevel = ELELogVerbosity::NoLogging;
-		EffectiveLevel = InheritedLevel;
-	}
-
-	/**
-	 * 更新有效级别
-	 * @param NewEffectiveLevel 新的有效级别
-	 */
-	void UpdateEffectiveLevel(ELELogVerbosity NewEffectiveLevel)
-	{
-		EffectiveLevel = NewEffectiveLevel;
-	}
-
-	/**
-	 * 设置分类启用状态
-	 * @param bEnabled 是否启用
-	 */
-	void SetEnabled(bool bEnabled)
-	{
-		bIsEnabled = bEnabled;
-	}
-
-	/**
-	 * 添加子节点索引
-	 * @param ChildIndex 子节点在数组中的索引
-	 */
-	void AddChild(int32 ChildIndex)
-	{
-		if (!ChildIndices.Contains(ChildIndex))
-		{
-			ChildIndices.Add(ChildIndex);
-		}
-	}
-
-	/**
-	 * 移除子节点索引
-	 * @param ChildIndex 要移除的子节点索引
-	 */
-	void RemoveChild(int32 ChildIndex)
-	{
-		ChildIndices.Remove(ChildIndex);
-	}
 
 	/**
 	 * 检查是否为根节点
@@ -152,6 +107,15 @@ public:
 		return ChildIndices.Num() == 0;
 	}
 
+	/**
+	 * 获取过滤字节：允许输出的最低级别，禁用时为 NoLogging
+	 * Get filter byte: the lowest level that passes, NoLogging when disabled
+	 */
+	uint8 GetFilterByte() const
+	{
+		return bIsEffectivelyEnabled ? static_cast<uint8>(EffectiveLevel) : static_cast<uint8>(ELELogVerbosity::NoLogging);
+	}
+
 	/**
 	 * 获取节点的调试信息字符串
 	 */
@@ -162,18 +126,18 @@ public:
 			bHasExplicitLevel ? TEXT("Yes") : TEXT("No"),
 			bHasExplicitLevel ? *UEnum::GetValueAsString(ExplicitLevel) : TEXT("None"),
 			*UEnum::GetValueAsString(EffectiveLevel),
-			bIsEnabled ? TEXT("Yes") : TEXT("No"),
+			bIsEffectivelyEnabled ? TEXT("Yes") : (bIsEnabled ? TEXT("No (inherited)") : TEXT("No")),
 			ParentIndex,
 			ChildIndices.Num());
 	}
 };
 
 /**
- * 日志分类树管理器 - UObject实现，支持UE反射系统
- * Log category tree manager - UObject implementation with UE reflection system support
+ * 日志分类树 - 蓝图门面
+ * Log category tree - thin Blueprint facade over FLECategoryTreeCore
  *
- * 负责管理整个分类树结构，提供高效的级别查询和修改功能
- * Manages the entire category tree structure, providing efficient level query and modification features
+ * 数据与逻辑都在纯 C++ 的 FLECategoryTreeCore 中，本对象只持有共享指针并转发调用，
+ * GC 不会遍历任何节点数据；非游戏线程应通过 GetCore() 取得共享指针后直接访问核心
  */
 UCLASS(BlueprintType, Category = "LogEverything")
 class LOGEVERYTHING_API ULECategoryTree : public UObject
@@ -183,24 +147,15 @@ class LOGEVERYTHING_API ULECategoryTree : public UObject
 public:
 	ULECategoryTree();
 
-protected:
-	/** 所有节点的数组存储（索引即为节点ID） */
-	UPROPERTY(BlueprintReadOnly, Category = "Tree Structure")
-	TArray<FLECategoryNode> Nodes;
-
-	/** 路径到节点索引的快速映射（使用FName提升性能） */
-	UPROPERTY()
-	TMap<FName, int32> PathToIndexMap;
-
-	/** 根节点索引 */
-	UPROPERTY(BlueprintReadOnly, Category = "Tree Structure")
-	int32 RootNodeIndex;
+	/** 获取分类树核心（线程安全共享指针） */
+	FORCEINLINE const TSharedRef<FLECategoryTreeCore, ESPMode::ThreadSafe>& GetCore() const { return Core; }
 
-	/** 树的版本号（用于检测变更） */
-	UPROPERTY(BlueprintReadOnly, Category = "Tree Structure")
-	int32 TreeVersion;
+	/**
+	 * 绑定到已有的分类树核心（例如子系统持有的核心）
+	 * @param InCore 分类树核心
+	 */
+	void SetCore(const TSharedRef<FLECategoryTreeCore, ESPMode::ThreadSafe>& InCore) { Core = InCore; }
 
-public:
 	/**
 	 * 初始化分类树
 	 * @param CategoryPaths 所有分类路径列表
@@ -219,6 +174,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LogEverything")
 	bool SetCategoryLevel(const FString& CategoryPath, ELELogVerbosity Level, bool bPropagate = false);
 
+	/**
+	 * 批量设置分类日志级别：一次解析、一次发布
+	 * @param CategoryLevels 分类与级别列表
+	 * @param bPropagate 是否强制传播到所有子节点
+	 * @return 成功应用的条目数
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	int32 ApplyCategoryLevels(const TArray<FLECategoryLevel>& CategoryLevels, bool bPropagate = false);
+
 	/**
 	 * 获取分类的有效日志级别
 	 * @param CategoryPath 分类路径
@@ -237,17 +201,33 @@ public:
 	bool ShouldLogCategory(const FName& CategoryName, ELELogVerbosity Level) const;
 
 	/**
-	 * 启用或禁用分类
+	 * 获取分类节点的只读视图
+	 * @param CategoryPath 分类路径
+	 * @param OutNode 输出的节点视图
+	 * @return 是否找到节点
+	 */
+	UFUNCTION(BlueprintPure, Category = "LogEverything")
+	bool GetCategoryNode(const FString& CategoryPath, FLECategoryNode& OutNode) const;
+
+	/**
+	 * 获取所有节点的只读视图（按前序排列，供 UI 显示）
+	 * @return 节点视图列表
+	 */
+	UFUNCTION(BlueprintPure, Category = "LogEverything")
+	TArray<FLECategoryNode> GetAllCategoryNodes() const;
+
+	/**
+	 * 启用或禁用分类（禁用由所有后代继承，重新启用即完全恢复）
 	 * @param CategoryPath 分类路径
 	 * @param bEnabled 是否启用
-	 * @param bPropagate 是否传播到子节点
+	 * @param bPropagate 是否同时覆盖所有子节点自身的开关
 	 * @return 设置是否成功
 	 */
 	UFUNCTION(BlueprintCallable, Category = "LogEverything")
 	bool SetCategoryEnabled(const FString& CategoryPath, bool bEnabled, bool bPropagate = false);
 
 	/**
-	 * 检查分类是否启用
+	 * 检查分类是否有效启用（自身与所有祖先都启用）
 	 * @param CategoryPath 分类路径
 	 * @return 是否启用
 	 */
@@ -291,73 +271,7 @@ public:
 	UFUNCTION(BlueprintPure, Category = "LogEverything")
 	FString ExportTreeDebugString() const;
 
-protected:
-	/**
-	 * 创建根节点
-	 */
-	void CreateRootNode();
-
-	/**
-	 * 查找或创建节点
-	 * @param CategoryPath 分类路径
-	 * @return 节点索引，失败返回INDEX_NONE
-	 */
-	int32 FindOrCreateNode(const FString& CategoryPath);
-
-	/**
-	 * 查找节点索引
-	 * @param CategoryPath 分类路径
-	 * @return 节点索引，未找到返回INDEX_NONE
-	 */
-	int32 FindNodeIndex(const FString& CategoryPath) const;
-
-	/**
-	 * 递归更新子节点的有效级别
-	 * @param NodeIndex 父节点索引
-	 * @param NewLevel 新的级别
-	 * @param bForceOverride 是否强制覆盖显式设置
-	 */
-	void UpdateChildrenEffectiveLevels(int32 NodeIndex, ELELogVerbosity NewLevel, bool bForceOverride);
-
-	/**
-	 * 递归更新子节点的启用状态
-	 * @param NodeIndex 父节点索引
-	 * @param bEnabled 启用状态
-	 */
-	void UpdateChildrenEnabledState(int32 NodeIndex, bool bEnabled);
-
-	/**
-	 * 分割路径为组件
-	 * @param Path 完整路径
-	 * @return 路径组件数组
-	 */
-	TArray<FString> SplitPath(const FString& Path) const;
-
-	/**
-	 * 构建路径字符串
-	 * @param Components 路径组件
-	 * @param EndIndex 结束索引（不包含）
-	 * @return 构建的路径
-	 */
-	FString BuildPath(const TArray<FString>& Components, int32 EndIndex) const;
-
-	/**
-	 * 验证节点索引的有效性
-	 * @param NodeIndex 要验证的索引
-	 * @return 是否有效
-	 */
-	bool IsValidNodeIndex(int32 NodeIndex) const;
-
-	/**
-	 * 递归收集调试信息
-	 * @param NodeIndex 节点索引
-	 * @param Depth 当前深度
-	 * @param OutString 输出字符串
-	 */
-	void CollectDebugInfo(int32 NodeIndex, int32 Depth, FString& OutString) const;
-
-	/**
-	 * 增加树版本号
-	 */
-	void IncrementVersion() { TreeVersion++; }
-};
\ No newline at end of file
+private:
+	/** 分类树核心（不是 UPROPERTY，GC 不感知） */
+	TSharedRef<FLECategoryTreeCore, ESPMode::ThreadSafe> Core;
+};
@@ -0,0 +1,531 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "System/LELogTypes.h"
+#include "Utils/LEEpochReclaimer.h"
+#include "Category/LECategoryRules.h"
+#include <atomic>
+
+struct FLECategoryNode;
+struct FLENativeCategoryFilter;
+
+/**
+ * 分类节点结构信息（冷数据，只在插入/重排/遍历时访问）
+ * Per-node structure links; children are threaded as first-child / next-sibling lists
+ */
+struct FLECategoryNodeLinks
+{
+	int32 ParentIndex = INDEX_NONE;
+	int32 FirstChildIndex = INDEX_NONE;
+	int32 LastChildIndex = INDEX_NONE;
+	int32 NextSiblingIndex = INDEX_NONE;
+
+	/** 子树结束索引（不包含），仅在前序布局下有效 */
+	int32 SubtreeEnd = INDEX_NONE;
+
+	int32 Depth = 0;
+
+	/** 对应的 BqLog 分类索引（CAT_INDEX），未绑定为 INDEX_NONE */
+	int32 BqCategoryIndex = INDEX_NONE;
+};
+
+/**
+ * 生成器输出的分类树引导表（见 Tools/GenerateCategoryTables.py 与 Generated/LogEverythingCategoryTables.h）
+ * Constexpr category tables emitted next to the BqLog generated logger
+ *
+ * 节点索引即 BqLog 分类索引，表已按前序排列，索引 0 为根节点
+ */
+struct FLECategoryTreeTables
+{
+	int32 NumCategories;
+	const FLECategoryNodeLinks* NodeLinks;
+	const TCHAR* const* FullNames;
+	const int32* FullNameLengths;
+
+	/** 子名称在完整名称中的起始偏移 */
+	const int32* SubNameOffsets;
+};
+
+/**
+ * 子节点查找键：（父节点索引, 子名称）
+ * Child lookup key; lets insertion walk a path one component at a time without building prefix strings
+ */
+struct FLECategoryChildKey
+{
+	int32 ParentIndex;
+	FName SubName;
+
+	bool operator==(const FLECategoryChildKey& Other) const
+	{
+		return ParentIndex == Other.ParentIndex && SubName == Other.SubName;
+	}
+
+	friend uint32 GetTypeHash(const FLECategoryChildKey& Key)
+	{
+		return HashCombineFast(::GetTypeHash(Key.ParentIndex), GetTypeHash(Key.SubName));
+	}
+};
+
+/**
+ * 分类过滤快照 - 发布后不可变
+ * Immutable category filter snapshot published via RCU
+ *
+ * 写者（游戏线程）在分类树变化时构建新快照并原子替换发布指针，
+ * 旧快照交给 FLEEpochReclaimer 在所有读者离开后释放
+ */
+struct FLECategoryFilterSnapshot
+{
+	/**
+	 * 按 BqLog 分类索引排列的过滤表，每个分类一个字节（允许输出的最低级别）
+	 * 按缓存行对齐，64 个分类共享一条缓存行，只需一次下标读取，无需哈希
+	 */
+	TArray<uint8, TAlignedHeapAllocator<PLATFORM_CACHE_LINE_SIZE>> FilterBytes;
+
+	/** 构建快照时的树版本号 */
+	int32 TreeVersion = 0;
+
+	/** 未绑定索引使用的过滤字节（分类树中与 ShouldLogCategory 的默认规则一致） */
+	uint8 DefaultFilterByte = static_cast<uint8>(ELELogVerbosity::Warning);
+
+	FORCEINLINE bool ShouldLog(uint32 BqCategoryIndex, ELELogVerbosity Level) const
+	{
+		if (BqCategoryIndex < static_cast<uint32>(FilterBytes.Num()))
+		{
+			return static_cast<uint8>(Level) >= FilterBytes.GetData()[BqCategoryIndex];
+		}
+		return static_cast<uint8>(Level) >= DefaultFilterByte;
+	}
+};
+
+/**
+ * 分类配置事务 - 暂存多条级别/启用修改，由 FLECategoryTreeCore::ApplyTransaction 一次性应用
+ * Staged category configuration changes, resolved in one pass and published once
+ *
+ * 修改按暂存顺序生效，结果与逐条调用 SetCategoryLevel / SetCategoryEnabled 相同
+ */
+class FLECategoryTreeTransaction
+{
+public:
+	enum class EChangeKind : uint8
+	{
+		Level,
+		Enabled
+	};
+
+	struct FChange
+	{
+		FString CategoryPath;
+		EChangeKind Kind;
+		ELELogVerbosity Level;
+		bool bEnabled;
+		bool bPropagate;
+	};
+
+	/** 暂存级别修改 */
+	FLECategoryTreeTransaction& SetCategoryLevel(const FString& CategoryPath, ELELogVerbosity Level, bool bPropagate = false)
+	{
+		Changes.Add(FChange{ CategoryPath, EChangeKind::Level, Level, true, bPropagate });
+		return *this;
+	}
+
+	/** 暂存启用状态修改 */
+	FLECategoryTreeTransaction& SetCategoryEnabled(const FString& CategoryPath, bool bEnabled, bool bPropagate = false)
+	{
+		Changes.Add(FChange{ CategoryPath, EChangeKind::Enabled, ELELogVerbosity::NoLogging, bEnabled, bPropagate });
+		return *this;
+	}
+
+	void Reserve(int32 NumChanges) { Changes.Reserve(NumChanges); }
+	void Reset() { Changes.Reset(); }
+	int32 Num() const { return Changes.Num(); }
+	bool IsEmpty() const { return Changes.Num() == 0; }
+	const TArray<FChange>& GetChanges() const { return Changes; }
+
+private:
+	TArray<FChange> Changes;
+};
+
+/**
+ * 日志分类树核心 - 纯 C++ 实现，不参与 GC 与反射
+ * Log category tree core - plain C++ storage and logic behind the ULECategoryTree facade
+ *
+ * 由 ULELogSubsystem 通过线程安全的共享指针持有，重新初始化时原地重建，不销毁对象；
+ * 所有公开接口都在 TreeLock 内执行，可以在任意线程调用，热路径判断只读取发布的快照
+ */
+class LOGEVERYTHING_API FLECategoryTreeCore
+{
+public:
+	FLECategoryTreeCore();
+	~FLECategoryTreeCore();
+
+	UE_NONCOPYABLE(FLECategoryTreeCore);
+
+private:
+	/**
+	 * 节点数据按结构数组（SoA）存储，所有数组以节点索引为下标，长度一致
+	 * 按深度优先前序排列，任一子树占据连续区间，级别/启用状态的传播是一次线性扫描
+	 * 新建节点先追加到末尾，下次传播或刷新过滤表前统一重排（见 EnsurePreOrderLayout）
+	 *
+	 * 纯 C++ 存储，不参与 GC 与反射；蓝图通过 ULECategoryTree::GetCategoryNode 获取节点视图
+	 */
+
+	/** 热数据：每个节点一个过滤字节（启用时为有效级别，禁用时为 NoLogging），64 个节点共享一条缓存行 */
+	TArray<uint8, TAlignedHeapAllocator<PLATFORM_CACHE_LINE_SIZE>> NodeFilterBytes;
+
+	/** 热数据：有效级别（考虑继承后的最终级别） */
+	TArray<ELELogVerbosity> EffectiveLevels;
+
+	/** 热数据：有效启用状态（自身与所有祖先都启用时才为 true），已合并进过滤字节 */
+	TArray<bool> EffectiveEnabledFlags;
+
+	/** 级别配置：显式设置的级别，以及是否有显式设置 */
+	TArray<ELELogVerbosity> ExplicitLevels;
+	TArray<bool> HasExplicitLevelFlags;
+
+	/** 启用配置：节点自身的启用开关，禁用由所有后代继承 */
+	TArray<bool> EnabledFlags;
+
+	/** 规则来源标记：哪些显式级别 / 禁用状态是分类规则写入的（规则更新时据此撤销） */
+	TArray<uint8> RuleFlags;
+	static constexpr uint8 RuleFlagLevel = 1 << 0;
+	static constexpr uint8 RuleFlagDisabled = 1 << 1;
+
+	/** 分类规则（按顺序求值），新节点创建时立即套用 */
+	TArray<FLECategoryRule> CategoryRules;
+
+	/** 结构数据：父子/兄弟链接、子树区间、深度与 BqLog 索引 */
+	TArray<FLECategoryNodeLinks> NodeLinks;
+
+	/** 命名数据：完整名称与子名称 */
+	TArray<FName> FullNames;
+	TArray<FName> SubNames;
+
+	/** 路径到节点索引的快速映射（使用FName提升性能） */
+	TMap<FName, int32> PathToIndexMap;
+
+	/** （父节点索引, 子名称）到子节点索引的映射，插入时逐级查找用；重排后重建 */
+	TMap<FLECategoryChildKey, int32> ChildLookup;
+
+	/** 根节点索引 */
+	int32 RootNodeIndex;
+
+	/** 树的版本号（用于检测变更） */
+	int32 TreeVersion;
+
+	/** BqLog 分类索引到节点索引的映射（下标即 CAT_INDEX） */
+	TArray<int32> BqIndexToNodeIndex;
+
+	/** 自上次重排后是否追加过节点（节点数组暂不满足前序布局） */
+	bool bLayoutDirty;
+
+	/**
+	 * 当前发布的过滤快照（RCU）
+	 * 热路径只通过该指针读取不可变快照，不加锁
+	 */
+	std::atomic<const FLECategoryFilterSnapshot*> FilterSnapshot{ nullptr };
+
+	/** 保护以上节点数据：任意线程都可以查询或修改分类树（可重入） */
+	mutable FCriticalSection TreeLock;
+
+public:
+	/**
+	 * 初始化分类树
+	 * @param CategoryPaths 所有分类路径列表
+	 * @return 初始化是否成功
+	 */
+	bool InitializeTree(const TArray<FString>& CategoryPaths);
+
+	/**
+	 * 从生成器引导表初始化分类树：结构数据直接复制，不拆分路径、不逐个插入节点
+	 * 节点索引与 BqLog 分类索引一致，BqLog 索引绑定随之完成
+	 * @param Tables 生成器输出的引导表
+	 * @return 初始化是否成功（表结构无效时返回 false）
+	 */
+	bool InitializeFromTables(const FLECategoryTreeTables& Tables);
+
+	/**
+	 * 批量注册分类（运行时动态分类、插件分类等），所有路径插入完成后只发布一次过滤表
+	 * @param CategoryPaths 分类路径列表
+	 * @return 新创建的节点数
+	 */
+	int32 RegisterCategories(TConstArrayView<FString> CategoryPaths);
+
+	/**
+	 * 应用分类配置事务：先写入所有显式级别与启用状态，再对受影响的前序区间做一次有效级别解析，
+	 * 最后只递增一次版本号、发布一次过滤表、输出一行汇总日志
+	 * @param Transaction 暂存的修改
+	 * @return 成功应用的修改数（无法创建节点的路径会被跳过）
+	 */
+	int32 ApplyTransaction(const FLECategoryTreeTransaction& Transaction);
+
+	/**
+	 * 设置分类规则并对整棵树编译：上一组规则写入的级别 / 禁用状态先撤销，再按新规则写入显式级别，
+	 * 最后一次解析有效级别并发布；之后新建的分类在创建时套用规则。
+	 * 之后的手动设置会清除对应节点的规则标记，再次设置规则时不会被撤销
+	 * @param Rules 按顺序求值的规则（后者覆盖前者），传入空数组即清除规则
+	 */
+	void SetCategoryRules(TArray<FLECategoryRule> Rules);
+
+	/** 获取当前分类规则 */
+	TArray<FLECategoryRule> GetCategoryRules() const;
+
+	/**
+	 * 获取分类树占用的堆内存（所有节点数组与查找表）
+	 */
+	SIZE_T GetAllocatedSize() const;
+
+	/**
+	 * 设置分类日志级别
+	 * @param CategoryPath 分类路径
+	 * @param Level 日志级别
+	 * @param bPropagate 是否强制传播到所有子节点
+	 * @return 设置是否成功
+	 */
+	bool SetCategoryLevel(const FString& CategoryPath, ELELogVerbosity Level, bool bPropagate = false);
+
+	/**
+	 * 获取分类的有效日志级别
+	 * @param CategoryPath 分类路径
+	 * @return 有效的日志级别
+	 */
+	ELELogVerbosity GetEffectiveLevel(const FString& CategoryPath) const;
+
+	/**
+	 * 检查分类是否应该输出指定级别的日志
+	 * @param CategoryName 分类名称
+	 * @param Level 要检查的日志级别
+	 * @return 是否应该输出日志
+	 */
+	bool ShouldLogCategory(const FName& CategoryName, ELELogVerbosity Level) const;
+
+	/**
+	 * 按 BqLog 分类索引检查是否应该输出（热路径，无哈希查找）
+	 * @param BqCategoryIndex BqLog 分类索引（CAT_INDEX）
+	 * @param Level 要检查的日志级别
+	 * @return 是否应该输出日志
+	 */
+	FORCEINLINE bool ShouldLogCategoryIndex(uint32 BqCategoryIndex, ELELogVerbosity Level) const
+	{
+		// 任意线程可调用：在纪元读区内读取不可变快照，不加锁，不会看到撕裂状态
+		FLEEpochReadScope ReadScope;
+		const FLECategoryFilterSnapshot* Snapshot = FilterSnapshot.load(std::memory_order_seq_cst);
+		if (Snapshot)
+		{
+			return Snapshot->ShouldLog(BqCategoryIndex, Level);
+		}
+		return static_cast<uint8>(Level) >= static_cast<uint8>(ELELogVerbosity::Warning);
+	}
+
+	/** 树的版本号（用于检测变更） */
+	int32 GetTreeVersion() const { return TreeVersion; }
+
+	/**
+	 * 绑定 BqLog 分类索引到树节点，并生成过滤表
+	 * @param BqCategoryNames BqLog 分类名称数组（下标即 CAT_INDEX，0 为默认空分类）
+	 * @return 绑定是否成功
+	 */
+	bool BindBqCategoryIndices(const TArray<FString>& BqCategoryNames);
+
+	/**
+	 * 复制当前发布的过滤快照（游戏线程），无快照时返回空
+	 */
+	FLECategoryFilterSnapshot* CopyFilterSnapshot() const;
+
+	/**
+	 * 获取分类绑定的 BqLog 分类索引
+	 * @param CategoryName 分类名称
+	 * @return BqLog 分类索引，未绑定返回 INDEX_NONE
+	 */
+	int32 GetBqCategoryIndex(const FName& CategoryName) const;
+
+	/**
+	 * 将过滤表编译为 BqLog 原生过滤输入（过滤字节 + BqLog 父分类索引）
+	 * @param OutFilter 输出的原生过滤输入
+	 */
+	void BuildNativeCategoryFilter(FLENativeCategoryFilter& OutFilter) const;
+
+	/**
+	 * 获取分类节点的只读视图
+	 * @param CategoryPath 分类路径
+	 * @param OutNode 输出的节点视图
+	 * @return 是否找到节点
+	 */
+	bool GetCategoryNode(const FString& CategoryPath, FLECategoryNode& OutNode) const;
+
+	/**
+	 * 获取所有节点的只读视图（按前序排列，供 UI 显示）
+	 * @return 节点视图列表
+	 */
+	TArray<FLECategoryNode> GetAllCategoryNodes() const;
+
+	/**
+	 * 启用或禁用分类：禁用由所有后代继承（子节点自身的开关保留），重新启用即完全恢复
+	 * @param CategoryPath 分类路径
+	 * @param bEnabled 是否启用
+	 * @param bPropagate 是否同时覆盖所有子节点自身的开关
+	 * @return 设置是否成功
+	 */
+	bool SetCategoryEnabled(const FString& CategoryPath, bool bEnabled, bool bPropagate = false);
+
+	/**
+	 * 检查分类是否有效启用（自身与所有祖先都启用），O(1) 读取
+	 * @param CategoryPath 分类路径
+	 * @return 是否启用
+	 */
+	bool IsCategoryEnabled(const FString& CategoryPath) const;
+
+	/**
+	 * 获取所有分类路径
+	 * @return 分类路径列表
+	 */
+	TArray<FString> GetAllCategoryPaths() const;
+
+	/**
+	 * 获取指定分类的子分类
+	 * @param CategoryPath 父分类路径
+	 * @return 子分类路径列表
+	 */
+	TArray<FString> GetChildCategories(const FString& CategoryPath) const;
+
+	/**
+	 * 重置所有分类到默认状态
+	 */
+	void ResetToDefault();
+
+	/**
+	 * 获取树的统计信息
+	 * @param OutTotalNodes 总节点数
+	 * @param OutMaxDepth 最大深度
+	 * @param OutExplicitNodes 有显式设置的节点数
+	 */
+	void GetTreeStatistics(int32& OutTotalNodes, int32& OutMaxDepth, int32& OutExplicitNodes) const;
+
+	/**
+	 * 导出树结构为调试字符串
+	 * @return 调试字符串
+	 */
+	FString ExportTreeDebugString() const;
+
+private:
+	/**
+	 * 创建根节点
+	 */
+	void CreateRootNode();
+
+	/**
+	 * 追加一个节点到所有结构数组，并链接到父节点的子节点链表末尾
+	 * @param SubName 子名称
+	 * @param FullName 完整名称
+	 * @param ParentIndex 父节点索引（根节点为 INDEX_NONE）
+	 * @param InheritedLevel 初始有效级别
+	 * @return 新节点索引
+	 */
+	int32 AddNode(FName SubName, FName FullName, int32 ParentIndex, ELELogVerbosity InheritedLevel);
+
+	/**
+	 * 生成节点的只读视图
+	 * @param NodeIndex 节点索引
+	 * @return 节点视图
+	 */
+	FLECategoryNode MakeNodeView(int32 NodeIndex) const;
+
+	/**
+	 * 根据启用状态与有效级别重算区间 [Begin, End) 的过滤字节
+	 */
+	void RefreshNodeFilterBytes(int32 Begin, int32 End);
+
+	/**
+	 * 查找或创建节点：在原字符串上按点切片逐级查找（父节点, 子名称），只为新节点注册完整路径名称
+	 * 插入总耗时与路径长度成线性关系，不产生临时字符串
+	 * @param CategoryPath 分类路径
+	 * @return 节点索引，失败返回INDEX_NONE
+	 */
+	int32 FindOrCreateNode(FStringView CategoryPath);
+
+	/**
+	 * 查找节点索引（不会向名称表注册新名称）
+	 * @param CategoryPath 分类路径
+	 * @return 节点索引，未找到返回INDEX_NONE
+	 */
+	int32 FindNodeIndex(FStringView CategoryPath) const;
+
+	/**
+	 * 将节点数组重排为深度优先前序并重建子树区间，布局未变脏时直接返回
+	 * 重排会改变节点索引：所有结构数组、节点链接、PathToIndexMap、BqIndexToNodeIndex 同步重映射
+	 * @param TrackedIndex 调用方持有的节点索引
+	 * @param TrackedIndices 调用方持有的一组节点索引，原地重映射
+	 * @return TrackedIndex 重排后的新索引
+	 */
+	int32 EnsurePreOrderLayout(int32 TrackedIndex = INDEX_NONE, TArrayView<int32> TrackedIndices = TArrayView<int32>());
+
+	/**
+	 * 解析前序区间 [Begin, End) 的有效级别与有效启用状态：父节点总在子节点之前，
+	 * 显式级别优先，否则继承父节点；任一祖先被禁用则节点被禁用
+	 * 区间之外的节点不受影响，调用方需保证区间覆盖所有改动节点的子树
+	 */
+	void ResolveEffectiveState(int32 Begin, int32 End);
+
+	/**
+	 * 对整棵树重新编译分类规则（需满足前序布局），调用方负责递增版本号
+	 * @return 匹配到规则的分类数
+	 */
+	int32 CompileCategoryRules();
+
+	/**
+	 * 对单个节点求值分类规则并写入显式级别 / 禁用状态（不解析有效级别）
+	 * @return 是否有规则匹配
+	 */
+	bool ApplyRulesToNode(int32 NodeIndex);
+
+	/** 清除区间 [Begin, End) 的规则来源标记 */
+	void ClearRuleFlags(int32 Begin, int32 End, uint8 Mask);
+
+	/**
+	 * 更新子树的有效级别（对前序区间 [NodeIndex + 1, SubtreeEnd) 的线性扫描，无递归）
+	 * @param NodeIndex 父节点索引（需满足前序布局）
+	 * @param NewLevel 新的级别
+	 * @param bForceOverride 是否强制覆盖显式设置
+	 */
+	void UpdateChildrenEffectiveLevels(int32 NodeIndex, ELELogVerbosity NewLevel, bool bForceOverride);
+
+	/**
+	 * 覆盖子树中所有节点自身的启用开关（不解析有效启用状态，见 ResolveEffectiveState）
+	 * @param NodeIndex 父节点索引（需满足前序布局）
+	 * @param bEnabled 启用状态
+	 */
+	void UpdateChildrenEnabledState(int32 NodeIndex, bool bEnabled);
+
+	/**
+	 * 验证节点索引的有效性
+	 * @param NodeIndex 要验证的索引
+	 * @return 是否有效
+	 */
+	bool IsValidNodeIndex(int32 NodeIndex) const;
+
+	/**
+	 * 递归收集调试信息
+	 * @param NodeIndex 节点索引
+	 * @param Depth 当前深度
+	 * @param OutString 输出字符串
+	 */
+	void CollectDebugInfo(int32 NodeIndex, int32 Depth, FString& OutString) const;
+
+	/**
+	 * 根据节点状态构建新的过滤快照并发布（持有 TreeLock）
+	 */
+	void RefreshCategoryFilterTable();
+
+	/**
+	 * 原子替换发布的快照，旧快照交给纪元回收器
+	 * @param NewSnapshot 新快照（可为空）
+	 */
+	void PublishFilterSnapshot(const FLECategoryFilterSnapshot* NewSnapshot);
+
+	/**
+	 * 增加树版本号（同时刷新过滤表）
+	 */
+	void IncrementVersion() { TreeVersion++; RefreshCategoryFilterTable(); }
+};
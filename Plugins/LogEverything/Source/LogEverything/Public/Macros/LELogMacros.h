@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Bridge/LEBqLogBridge.h"
 #include "Utils/LogEverythingUtils.h"
+#include "System/LEObjectWatchList.h"
 #include "Engine/Engine.h"
 
 // 前向声明
@@ -15,23 +16,128 @@ class ULELogSubsystem;
  * Core logging macros for the LogEverything system
  */
 
+/**
+ * 分类未显式声明时的编译期最低级别
+ * Shipping/Test 与 LE_LOG_DEBUG 的处理保持一致，Verbose/Debug 调用不编译进二进制
+ */
+#ifndef LE_COMPILED_MIN_VERBOSITY_DEFAULT
+	#if (UE_BUILD_SHIPPING || UE_BUILD_TEST)
+		#define LE_COMPILED_MIN_VERBOSITY_DEFAULT ELELogVerbosity::Info
+	#else
+		#define LE_COMPILED_MIN_VERBOSITY_DEFAULT ELELogVerbosity::Verbose
+	#endif
+#endif
+
+/** 构建配置覆盖表（由 Build.cs 定义，未定义时为空） */
+#ifndef LE_COMPILED_MIN_VERBOSITY_OVERRIDES
+	#define LE_COMPILED_MIN_VERBOSITY_OVERRIDES
+#endif
+
+namespace LogEverything
+{
+	namespace Private
+	{
+		/** 从 BqLog 生成的分类结构体推导其 CAT_INDEX（仅用于 decltype，无需定义） */
+		template<uint32 CatIndex>
+		TIntegralConstant<uint32, CatIndex> DeduceBqCategoryIndex(const bq::log_category_base<CatIndex>*);
+
+		/** 编译期获取 BqLog 分类结构体对应的分类索引 */
+		template<typename BqCategoryType>
+		struct TBqCategoryIndex
+		{
+			static constexpr uint32 Value = decltype(DeduceBqCategoryIndex(static_cast<const BqCategoryType*>(nullptr)))::Value;
+		};
+
+		/**
+		 * 分类描述符的基类，使 DECLARE_LE_CATEGORY_EXTERN 的第三个参数可以直接写级别名（如 Warning）
+		 */
+		struct FLECompiledVerbosityNames
+		{
+			static constexpr ELELogVerbosity Verbose = ELELogVerbosity::Verbose;
+			static constexpr ELELogVerbosity Debug = ELELogVerbosity::Debug;
+			static constexpr ELELogVerbosity Info = ELELogVerbosity::Info;
+			static constexpr ELELogVerbosity Warning = ELELogVerbosity::Warning;
+			static constexpr ELELogVerbosity Error = ELELogVerbosity::Error;
+			static constexpr ELELogVerbosity Fatal = ELELogVerbosity::Fatal;
+			static constexpr ELELogVerbosity NoLogging = ELELogVerbosity::NoLogging;
+		};
+
+		/** 未声明编译期最低级别时使用默认值 */
+		constexpr ELELogVerbosity SelectDeclaredVerbosity(ELELogVerbosity DefaultVerbosity)
+		{
+			return DefaultVerbosity;
+		}
+
+		/** 声明了编译期最低级别时使用声明值 */
+		constexpr ELELogVerbosity SelectDeclaredVerbosity(ELELogVerbosity DefaultVerbosity, ELELogVerbosity DeclaredVerbosity)
+		{
+			return DeclaredVerbosity;
+		}
+
+		/**
+		 * 由 LogEverything.Build.cs 根据 Config/LogEverythingCategories.txt 中当前构建配置的
+		 * //@CompiledMinVerbosity 指令生成，每项为 (BqLog 分类索引 << 8) | 级别，已展开到子分类
+		 * 首项为哨兵，保证未定义覆盖时数组仍然合法
+		 */
+		constexpr uint32 CompiledVerbosityOverrides[] = { 0xFFFFFFFFu, LE_COMPILED_MIN_VERBOSITY_OVERRIDES };
+
+		/** 解析分类的编译期最低级别：构建配置覆盖 > 声明值 > 全局默认值 */
+		constexpr ELELogVerbosity ResolveCompiledMinVerbosity(uint32 CategoryIndex, ELELogVerbosity DeclaredVerbosity)
+		{
+			for (uint32 Entry : CompiledVerbosityOverrides)
+			{
+				if (Entry != 0xFFFFFFFFu && (Entry >> 8) == CategoryIndex)
+				{
+					return static_cast<ELELogVerbosity>(Entry & 0xFFu);
+				}
+			}
+			return DeclaredVerbosity;
+		}
+
+		/** 某级别是否被编译进该分类（用于 if constexpr） */
+		template<typename CategoryType>
+		constexpr bool IsCompiledIn(ELELogVerbosity Level)
+		{
+			return CategoryType::CompiledMinimumVerbosity != ELELogVerbosity::NoLogging
+				&& static_cast<uint8>(Level) >= static_cast<uint8>(CategoryType::CompiledMinimumVerbosity);
+		}
+	}
+}
+
 /**
  * LE 分类声明宏 - 在头文件中声明日志分类（仅负责类声明）
  * LE Category declaration macro - declare log category in header files (class declaration only)
  *
  * 类似于 UE 的 DECLARE_LOG_CATEGORY_EXTERN，只负责声明，不包含任何实现
+ * 生成的类是一个编译期分类描述符：
+ * - CategoryIndex：BqLog 分类索引（constexpr），日志过滤只使用该索引
+ * - CategoryPath：分类路径字面量
+ * - CompiledMinimumVerbosity：编译期最低级别，低于它的 LE_LOG 调用成为 if constexpr 死代码
+ * - GetCategoryName()：首次调用时才创建并缓存 FName，仅供仍需名称的配置接口使用
  *
  * @param Category     C++ 标识符名称 (如 LogGameCombatSkill)
  * @param BqCategoryPath   BqLog 分类路径 (如 Game.Combat.Skill)
+ * @param ...          可选，编译期最低级别 (如 Warning)，默认为 LE_COMPILED_MIN_VERBOSITY_DEFAULT
  *
  * 使用示例：
  * DECLARE_LE_CATEGORY_EXTERN(LogGameCombatSkill, Game.Combat.Skill);
+ * DECLARE_LE_CATEGORY_EXTERN(LogGameAI, Game.AI, Warning);
  */
-#define DECLARE_LE_CATEGORY_EXTERN(Category, BqCategoryPath) \
-	class FLECategory##Category \
+#define DECLARE_LE_CATEGORY_EXTERN(Category, BqCategoryPath, ...) \
+	class FLECategory##Category : public LogEverything::Private::FLECompiledVerbosityNames \
 	{ \
 	public: \
-		static const FName GetCategoryName() { return FName(TEXT(#BqCategoryPath)); } \
+		static constexpr uint32 CategoryIndex = \
+			LogEverything::Private::TBqCategoryIndex<decltype(DeclVal<const bq::LogEverythingLogger&>().cat.BqCategoryPath)>::Value; \
+		static constexpr const TCHAR* CategoryPath = TEXT(#BqCategoryPath); \
+		static constexpr ELELogVerbosity CompiledMinimumVerbosity = LogEverything::Private::ResolveCompiledMinVerbosity( \
+			CategoryIndex, LogEverything::Private::SelectDeclaredVerbosity(LE_COMPILED_MIN_VERBOSITY_DEFAULT, ##__VA_ARGS__)); \
+		static constexpr uint32 GetCategoryIndex() { return CategoryIndex; } \
+		static const FName& GetCategoryName() \
+		{ \
+			static const FName CachedCategoryName(CategoryPath); \
+			return CachedCategoryName; \
+		} \
 		static auto GetCategoryHandle(const bq::LogEverythingLogger& Logger) -> decltype((Logger.cat.BqCategoryPath)) \
 		{ \
 			return Logger.cat.BqCategoryPath; \
@@ -64,9 +170,11 @@ class ULELogSubsystem;
  * LE_LOG(LogGameCombatSkill, Warning, TEXT("Player {} cast skill {}"), PlayerName, SkillName);
  *
  * 架构优势：
- * - 通过 ULELogUtils::InternalLogImp 统一处理日志流程
- * - 先进行级别判断（LELogSubsystem），再进行实际打印（Bridge）
- * - 避免不必要的字符串格式化，提升性能
+ * - 低于分类编译期最低级别的调用在编译期被剔除，参数不求值、模板不实例化
+ * - 每个展开处持有一个静态调用点记录，稳态下级别判断只需一次 relaxed load 与纪元比较
+ * - 级别判断在包裹整个调用的 if 中完成，被过滤的日志不会对参数表达式求值
+ * - 判断通过后由 ULELogUtils::InternalLogImp 负责实际打印（Bridge），该分支标记为 UNLIKELY，
+ *   BqLog 序列化位于按参数类型签名实例化的非内联 EmitLog 中，调用点只内联级别判断
  * - 职责分离：Subsystem负责分类管理，Bridge负责BqLog交互
  *
  * @param Category   已声明的分类 (如 LogGameCombatSkill)
@@ -75,7 +183,18 @@ class ULELogSubsystem;
  * @param ...        格式化参数
  */
 #define LE_LOG(Category, Verbosity, Format, ...) \
-	ULogEverythingUtils::InternalLogImp(Category, ELELogVerbosity::Verbosity, Format, ##__VA_ARGS__) \
+	do \
+	{ \
+		if constexpr (LogEverything::Private::IsCompiledIn<decltype(Category)>(ELELogVerbosity::Verbosity)) \
+		{ \
+			static FLELogCallSite LE_LogCallSite; \
+			if (UNLIKELY(ULogEverythingUtils::ShouldLogCallSite(LE_LogCallSite, decltype(Category)::CategoryIndex, ELELogVerbosity::Verbosity))) \
+			{ \
+				ULogEverythingUtils::InternalLogImp(Category, ELELogVerbosity::Verbosity, Format, ##__VA_ARGS__); \
+			} \
+		} \
+	} while (0)
+
 /**
  * 条件日志宏
  * Conditional logging macro
@@ -133,6 +252,37 @@ class ULELogSubsystem;
 		} \
 	} while (0)
 
+/**
+ * 对象日志宏 - 分类阈值之上正常输出，之下只为观察列表中的对象/实体输出
+ * Per-object logging macro - below the category threshold, only watched objects/entities are emitted
+ *
+ * 观察对象只越过级别阈值：禁用的分类与本线程 NoLogging 覆盖的分类仍然不输出
+ *
+ * 观察列表由 ULELogSubsystem::WatchObject / WatchEntity 或 LE.Debug.WatchObject 控制台命令管理；
+ * 列表为空时只比 LE_LOG 多一次 relaxed load，未观察的对象由布隆过滤器拒绝
+ * 原生过滤模式下列表非空期间 BqLog 被放宽为全开（见 FLEObjectWatchList），观察对象的日志不会被其级别位图拦截
+ *
+ * @param Object     UObject 指针或 uint64 实体 ID
+ * @param Category   日志分类
+ * @param Verbosity  日志级别
+ * @param Format     格式化字符串
+ * @param ...        格式化参数
+ */
+#define LE_LOG_OBJ(Object, Category, Verbosity, Format, ...) \
+	do \
+	{ \
+		if constexpr (LogEverything::Private::IsCompiledIn<decltype(Category)>(ELELogVerbosity::Verbosity)) \
+		{ \
+			static FLELogCallSite LE_LogCallSite; \
+			if (UNLIKELY(ULogEverythingUtils::ShouldLogCallSite(LE_LogCallSite, decltype(Category)::CategoryIndex, ELELogVerbosity::Verbosity) \
+				|| (FLEObjectWatchList::IsWatched(FLEObjectWatchList::GetObjectId(Object)) \
+					&& ULogEverythingUtils::IsCategoryEffectivelyEnabled(decltype(Category)::CategoryIndex)))) \
+			{ \
+				ULogEverythingUtils::InternalLogImp(Category, ELELogVerbosity::Verbosity, Format, ##__VA_ARGS__); \
+			} \
+		} \
+	} while (0)
+
 
 /**
  * 便利宏 - 快速访问常用日志级别
@@ -142,6 +292,8 @@ class ULELogSubsystem;
 #define LE_LOG_ERROR(CategoryHandle, Format, ...)   LE_LOG(CategoryHandle, Error, Format, ##__VA_ARGS__)
 #define LE_LOG_WARNING(CategoryHandle, Format, ...) LE_LOG(CategoryHandle, Warning, Format, ##__VA_ARGS__)
 #define LE_LOG_INFO(CategoryHandle, Format, ...)     LE_LOG(CategoryHandle, Info, Format, ##__VA_ARGS__)
+#define LE_LOG_OBJ_WARNING(Object, CategoryHandle, Format, ...) LE_LOG_OBJ(Object, CategoryHandle, Warning, Format, ##__VA_ARGS__)
+#define LE_LOG_OBJ_INFO(Object, CategoryHandle, Format, ...)    LE_LOG_OBJ(Object, CategoryHandle, Info, Format, ##__VA_ARGS__)
 
 /**
  * 运行时配置宏 - 通过 ULELogUtils 调用 LELogSubsystem
@@ -180,8 +332,12 @@ class ULELogSubsystem;
 	#define LE_CLOG_DEBUG(Condition, CategoryHandle, Format, ...)  LE_CLOG(Condition, CategoryHandle, Debug, Format, ##__VA_ARGS__)
 	#define LE_LOG_DEBUG(CategoryHandle, Format, ...)  LE_LOG(CategoryHandle, Debug, Format, ##__VA_ARGS__)
 	#define LE_LOG_VERBOSE(CategoryHandle, Format, ...)  LE_LOG(CategoryHandle, Verbose, Format, ##__VA_ARGS__)
+	#define LE_LOG_OBJ_DEBUG(Object, CategoryHandle, Format, ...)  LE_LOG_OBJ(Object, CategoryHandle, Debug, Format, ##__VA_ARGS__)
+	#define LE_LOG_OBJ_VERBOSE(Object, CategoryHandle, Format, ...)  LE_LOG_OBJ(Object, CategoryHandle, Verbose, Format, ##__VA_ARGS__)
 #else
 	#define LE_LOG_DEBUG(CategoryHandle, Format, ...)  ((void)0)
 	#define LE_LOG_VERBOSE(CategoryHandle, Format, ...)  ((void)0)
 	#define LE_CLOG_DEBUG(Condition, CategoryHandle, Format, ...)  ((void)0)
+	#define LE_LOG_OBJ_DEBUG(Object, CategoryHandle, Format, ...)  ((void)0)
+	#define LE_LOG_OBJ_VERBOSE(Object, CategoryHandle, Format, ...)  ((void)0)
 #endif
\ No newline at end of file
@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "System/LELogTypes.h"
+#include <atomic>
+
+/**
+ * 日志过滤决策追踪器
+ * Lock-free, off-hot-path recorder for filtering decisions
+ *
+ * - 开关是一个普通的原子标志，只在慢路径（调用点重新计算、按名称查询）上检查
+ * - 决策按采样间隔写入每线程的有界环形缓冲，并按分类 × 级别聚合计数
+ * - 记录过程只使用原子操作，不加锁、不分配、不会回调日志系统
+ * - 转储通过 UE_LOG 输出，同样不会重新进入 LE 日志管线
+ *
+ * 由 CVar LogEverything.Debug.LogCategory（0/1）与 LogEverything.Debug.TraceSampleInterval 控制
+ */
+class LOGEVERYTHING_API FLEDecisionTracer
+{
+public:
+	/** 每线程环形缓冲容量（2 的幂） */
+	static constexpr uint32 RingCapacity = 64;
+
+	/** 参与聚合统计的最大分类数，超出的分类只进入环形缓冲 */
+	static constexpr uint32 MaxTracedCategories = 256;
+
+	/** 参与聚合统计的级别数（Verbose..Fatal） */
+	static constexpr uint32 NumTracedLevels = static_cast<uint32>(ELELogVerbosity::Fatal) + 1;
+
+	/** 追踪是否开启（relaxed load，仅在慢路径上调用） */
+	FORCEINLINE static bool IsEnabled()
+	{
+		return bEnabled.load(std::memory_order_relaxed);
+	}
+
+	/** 开启或关闭追踪 */
+	static void SetEnabled(bool bInEnabled);
+
+	/** 设置环形缓冲采样间隔（每 N 次决策记录一次，聚合计数不受影响） */
+	static void SetSampleInterval(int32 InSampleInterval);
+
+	/**
+	 * 记录一次过滤决策
+	 * @param CategoryIndex BqLog 分类索引（INDEX_NONE 表示未绑定的分类）
+	 * @param Level 日志级别
+	 * @param bDecision 是否允许输出
+	 */
+	static void Record(int32 CategoryIndex, ELELogVerbosity Level, bool bDecision);
+
+	/** 清空聚合计数与所有线程的环形缓冲 */
+	static void Reset();
+
+	/**
+	 * 导出追踪信息
+	 * @param MaxRecentPerThread 每个线程最多输出的最近决策数
+	 */
+	static FString ExportDebugString(int32 MaxRecentPerThread = 16);
+
+private:
+	/** 追踪开关 */
+	static std::atomic<bool> bEnabled;
+
+	/** 环形缓冲采样间隔 */
+	static std::atomic<uint32> SampleInterval;
+};
@@ -0,0 +1,79 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "System/LELogTypes.h"
+#include <atomic>
+
+/**
+ * 丢失日志统计快照
+ * Aggregated dropped-entry counts, indexed by BqLog category index and level
+ */
+struct LOGEVERYTHING_API FLEDropCountSnapshot
+{
+	/** 每个级别的计数槽位数（Verbose .. Fatal） */
+	static constexpr int32 NumLevels = static_cast<int32>(ELELogVerbosity::Fatal) + 1;
+
+	/** 按 [分类索引 * NumLevels + 级别] 排列的计数 */
+	TArray<uint64> Counts;
+
+	/** 所有分类与级别的总数 */
+	uint64 Total = 0;
+
+	/** 单个分类与级别的计数 */
+	uint64 Get(int32 CategoryIndex, ELELogVerbosity Level) const
+	{
+		const int32 Slot = CategoryIndex * NumLevels + static_cast<int32>(Level);
+		return static_cast<uint8>(Level) < NumLevels && Counts.IsValidIndex(Slot) ? Counts[Slot] : 0;
+	}
+
+	/** 分类数 */
+	int32 NumCategories() const { return Counts.Num() / NumLevels; }
+};
+
+/**
+ * 丢失日志计数器 - 记录因 BqLog 缓冲区写满而丢失的日志
+ * Lock-free per-thread dropped-entry counters
+ *
+ * - 每个线程首次丢失日志时分配一块私有计数表（分类 × 级别），之后只由该线程写入，
+ *   记录一次丢失只是一次 relaxed load + store，不与其他线程争用缓存行
+ * - 读取时在锁内汇总所有线程的计数表；线程退出时其计数并入退役总数，不会丢失
+ * - Reset 只记录基线，读取结果减去基线，写入方无需配合
+ * - 汇总日志所需的"未报告"数在汇总时由各线程计数表的总数减去上次已报告的总数得出；
+ *   共享的只有一个"有未报告丢失"标志，写入方只在它为 false 时写一次，丢失风暴中该缓存行保持只读共享
+ */
+class LOGEVERYTHING_API FLEDropCounters
+{
+public:
+	/** 记录一条丢失的日志（任意线程，无锁） */
+	static void RecordDrop(uint32 CategoryIndex, ELELogVerbosity Level);
+
+	/** 汇总所有线程的计数（减去 Reset 时的基线） */
+	static FLEDropCountSnapshot Snapshot();
+
+	/** 丢失总数（减去基线） */
+	static uint64 GetTotal();
+
+	/** 将当前计数设为基线，之后的快照从零开始 */
+	static void Reset();
+
+	/** 是否有尚未写入汇总日志的丢失 */
+	FORCEINLINE static bool HasUnreported()
+	{
+		return bHasUnreported.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * 取出自上次汇总以来的丢失数（不受 Reset 影响），并把它们标记为已报告
+	 * 与标志清除并发的丢失最迟在下一次汇总中报告
+	 */
+	static uint64 ConsumeUnreported();
+
+	/** 汇总日志写入失败时归还未报告的丢失数 */
+	static void RestoreUnreported(uint64 Count);
+
+private:
+	/** 是否有未报告的丢失（只在从 false 变为 true 时写入） */
+	static std::atomic<bool> bHasUnreported;
+};
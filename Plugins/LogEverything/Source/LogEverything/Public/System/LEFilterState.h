@@ -0,0 +1,77 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "System/LELogTypes.h"
+#include "Category/LECategoryTreeCore.h"
+#include "Utils/LEEpochReclaimer.h"
+#include <atomic>
+
+/**
+ * 进程级过滤状态 - 由 FLogEverythingModule 在 StartupModule 中创建，ShutdownModule 中销毁
+ * Process-wide filter state owned by the module, valid from module load through shutdown
+ *
+ * - 通过单个原子指针发布，任何线程在任何时刻（早期启动、Commandlet、服务器启动）都能无锁读取
+ * - 在 GameInstance 出现之前使用引导快照（Info 及以上）
+ * - ULELogSubsystem 只是它的视图：子系统的分类树成为活动树后，树的每次变化都会同步发布到这里
+ */
+class LOGEVERYTHING_API FLEFilterState
+{
+public:
+	FLEFilterState();
+	~FLEFilterState();
+
+	/** 创建并发布进程级状态（FLogEverythingModule::StartupModule） */
+	static void Startup();
+
+	/** 摘下并退休进程级状态（FLogEverythingModule::ShutdownModule） */
+	static void Shutdown();
+
+	/** 获取当前发布的状态（模块加载前 / 卸载后为空），调用方需处于 FLEEpochReadScope 内 */
+	FORCEINLINE static const FLEFilterState* Get()
+	{
+		return ActiveState.load(std::memory_order_seq_cst);
+	}
+
+	/**
+	 * 任意线程、任意时刻的分类级别判断
+	 * @param BqCategoryIndex BqLog 分类索引
+	 * @param Level 日志级别
+	 */
+	static bool ShouldLog(uint32 BqCategoryIndex, ELELogVerbosity Level);
+
+	/** 设置活动分类树，传入空指针表示子系统已离开，保留最后一次发布的快照 */
+	static void SetActiveTree(const FLECategoryTreeCore* InTree);
+
+	/** 是否为当前活动分类树 */
+	static bool IsActiveTree(const FLECategoryTreeCore* InTree);
+
+	/**
+	 * 从活动分类树发布快照（调用方持有该树的 TreeLock），会复制一份独立的快照
+	 * @param TreeSnapshot 分类树刚发布的快照，为空时恢复引导快照
+	 */
+	static void PublishFromTree(const FLECategoryTreeCore* InTree, const FLECategoryFilterSnapshot* TreeSnapshot);
+
+	/** 在读区内读取当前快照 */
+	FORCEINLINE const FLECategoryFilterSnapshot* GetSnapshot() const
+	{
+		return Snapshot.load(std::memory_order_seq_cst);
+	}
+
+private:
+	/** 发布新快照，旧快照交给纪元回收器 */
+	void PublishSnapshot(const FLECategoryFilterSnapshot* NewSnapshot);
+
+	/** 构建引导快照：GameInstance 出现之前的默认规则 */
+	static FLECategoryFilterSnapshot* CreateBootstrapSnapshot();
+
+	/** 当前过滤快照 */
+	std::atomic<const FLECategoryFilterSnapshot*> Snapshot;
+
+	/** 当前活动分类树（只用于身份比较；分类树核心可在任意线程修改，因此为原子量） */
+	std::atomic<const FLECategoryTreeCore*> ActiveTree;
+
+	/** 进程级状态指针 */
+	static std::atomic<FLEFilterState*> ActiveState;
+};
@@ -0,0 +1,48 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "System/LELogTypes.h"
+#include <atomic>
+
+/**
+ * 日志调用点记录 - 每个 LE_LOG 展开处持有一个静态实例
+ * Per call-site gating record - one static instance per LE_LOG expansion
+ *
+ * 状态打包为一个 64 位原子量：[Epoch:32][CategoryIndex:31][Decision:1]
+ * 稳态下只需一次 relaxed load 并与全局纪元比较；过滤状态变化时全局纪元递增，
+ * 各调用点在下一次执行时重新计算决策
+ */
+struct FLELogCallSite
+{
+	/** 打包后的调用点状态，0 表示从未计算（全局纪元从 1 开始） */
+	std::atomic<uint64> PackedState{ 0 };
+
+	static constexpr uint64 DecisionMask = 1ull;
+	static constexpr uint32 CategoryIndexShift = 1;
+	static constexpr uint32 EpochShift = 32;
+
+	FORCEINLINE static uint64 Pack(uint32 Epoch, uint32 CategoryIndex, bool bDecision)
+	{
+		return (static_cast<uint64>(Epoch) << EpochShift)
+			| (static_cast<uint64>(CategoryIndex & 0x7FFFFFFFu) << CategoryIndexShift)
+			| (bDecision ? DecisionMask : 0ull);
+	}
+
+	FORCEINLINE static uint32 GetEpoch(uint64 State) { return static_cast<uint32>(State >> EpochShift); }
+	FORCEINLINE static uint32 GetCategoryIndex(uint64 State) { return static_cast<uint32>(State >> CategoryIndexShift) & 0x7FFFFFFFu; }
+	FORCEINLINE static bool GetDecision(uint64 State) { return (State & DecisionMask) != 0; }
+};
+
+namespace LogEverything
+{
+	/** 全局过滤纪元：分类树、过滤模式或子系统状态变化时递增 */
+	extern LOGEVERYTHING_API std::atomic<uint32> GCallSiteEpoch;
+
+	/** 使所有调用点缓存失效 */
+	FORCEINLINE void InvalidateCallSites()
+	{
+		GCallSiteEpoch.fetch_add(1, std::memory_order_release);
+	}
+}
@@ -5,26 +5,11 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "System/LELogTypes.h"
-#include "Category//LECategoryTree.h"
+#include "Category/LECategoryTree.h"
 #include "Bridge/LEBqLogBridge.h"
+#include "System/LEFilterState.h"
 #include "LELogSubsystem.generated.h"
 
-namespace LogEverything
-{
-	namespace ConsoleVariable
-	{
-		/** Controls whether category debug information is printed */
-		static TAutoConsoleVariable<bool> DebugLogCategory(
-			TEXT("LogEverything.Debug.LogCategory"),
-			false,
-			TEXT("Controls whether LogEverything prints category debug details\n")
-			TEXT("0: Disable category debug information (default)\n")
-			TEXT("1: Enable category debug information"),
-			ECVF_Default
-		);
-	}
-}
-
 /**
  * LogEverything 子系统
  * 管理整个日志系统的生命周期和配置
@@ -49,6 +34,95 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LogEverything")
 	bool SetCategoryLevel(const FName& CategoryPath, ELELogVerbosity Level, bool bPropagate = false);
 
+	/**
+	 * 批量设置分类日志级别（例如应用 QA 级别配置）：一次解析、一次发布
+	 * @return 成功应用的条目数
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	int32 ApplyCategoryLevels(const TArray<FLECategoryLevel>& CategoryLevels, bool bPropagate = false);
+
+	/** 应用分类配置事务（级别与启用状态混合修改），返回成功应用的修改数 */
+	int32 ApplyCategoryTransaction(const FLECategoryTreeTransaction& Transaction);
+
+	/**
+	 * 设置分类规则，如 "Game.*.Input=Warning"、"**.Pathfinding=Verbose"、"!Test.**"（按顺序求值，后者覆盖前者）
+	 * 规则在设置时编译为各分类的显式级别，新分类出现时自动套用；也可通过 LogEverything.CategoryRules 控制台变量 / 配置设置
+	 * @return 是否所有规则都有效（无效规则被跳过）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	bool SetCategoryRules(const TArray<FString>& Rules);
+
+	/** 获取当前分类规则 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	TArray<FString> GetCategoryRules() const;
+
+	/** 从规则列表文本设置分类规则（以分号、逗号或空白分隔） */
+	bool SetCategoryRulesFromString(const FString& RulesText);
+
+	/**
+	 * 设置缓冲区写满时各级别的可靠性策略（Drop / Block / Guaranteed）
+	 * @return 策略是否完整生效
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	bool SetReliabilityPolicy(const FLELogReliabilityPolicy& Policy);
+
+	/** 获取当前可靠性策略 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	FLELogReliabilityPolicy GetReliabilityPolicy() const;
+
+	/** 从策略文本设置可靠性策略（如 "Verbose=Drop,Error=Guaranteed,BlockTimeoutMs=5"），未提及的级别保持不变 */
+	bool SetReliabilityPolicyFromString(const FString& PolicyText);
+
+	/**
+	 * 设置日志路由：匹配的分类与级别写入各自独立的 BqLog 实例（独立缓冲区与工作线程）
+	 * @return 是否所有路由都已生效
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	bool SetLogRoutes(const TArray<FLELogRoute>& Routes);
+
+	/** 获取当前日志路由 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	TArray<FLELogRoute> GetLogRoutes() const;
+
+	/** 因 BqLog 缓冲区写满而丢失的日志总数（自启动或上次重置以来） */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything|Statistics")
+	int64 GetDroppedEntryCount() const;
+
+	/** 按分类与级别的丢失统计（只包含非零项，按丢失数降序） */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything|Statistics")
+	TArray<FLEDroppedEntryStat> GetDroppedEntryStats() const;
+
+	/** 重置丢失统计 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything|Statistics")
+	void ResetDroppedEntryStats();
+
+	/**
+	 * 观察对象：该对象的 LE_LOG_OBJ 日志在低于分类阈值时也会输出
+	 * @return 是否新加入观察列表
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	bool WatchObject(const UObject* Object);
+
+	/** 取消观察对象 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	bool UnwatchObject(const UObject* Object);
+
+	/** 观察任意实体 ID（与 LE_LOG_OBJ 传入的 uint64 ID 对应） */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	bool WatchEntity(int64 EntityId);
+
+	/** 取消观察实体 ID */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	bool UnwatchEntity(int64 EntityId);
+
+	/** 清空对象观察列表 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	void ClearWatchList();
+
+	/** 获取所有被观察的对象/实体 ID */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	TArray<int64> GetWatchedIds() const;
+
 	/** 获取特定分类的有效日志级别 */
 	UFUNCTION(BlueprintCallable, Category = "LogEverything")
 	ELELogVerbosity GetEffectiveLevel(const FName& CategoryPath) const;
@@ -57,11 +131,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LogEverything")
 	bool ShouldLogCategory(const FName& CategoryName, ELELogVerbosity Level) const;
 
-	/** 启用或禁用特定分类 */
+	/** 按 BqLog 分类索引判断是否应该记录日志（读取进程级过滤状态，任意线程可调用） */
+	FORCEINLINE bool ShouldLogCategoryIndex(uint32 BqCategoryIndex, ELELogVerbosity Level) const
+	{
+		return FLEFilterState::ShouldLog(BqCategoryIndex, Level);
+	}
+
+	/** 启用或禁用特定分类（禁用由所有子分类继承，重新启用即完全恢复） */
 	UFUNCTION(BlueprintCallable, Category = "LogEverything")
 	bool SetCategoryEnabled(const FName& CategoryPath, bool bEnabled, bool bPropagate = false);
 
-	/** 检查特定分类是否已启用 */
+	/** 检查特定分类是否有效启用（自身与所有祖先都启用） */
 	UFUNCTION(BlueprintCallable, Category = "LogEverything")
 	bool IsCategoryEnabled(const FName& CategoryPath) const;
 
@@ -93,6 +173,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LogEverything")
 	bool ReloadLogSettings();
 
+	/**
+	 * 运行时应用新的日志设置（appender、缓冲区、线程模式、过滤模式与分类级别），无需重启进程
+	 * @return BqLog 配置是否生效
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	bool ApplyLogSettings(const FLELogSettings& Settings);
+
 	/** 设置全局日志级别 */
 	UFUNCTION(BlueprintCallable, Category = "LogEverything")
 	void SetGlobalLogLevel(ELELogVerbosity Level);
@@ -101,9 +188,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LogEverything")
 	ELELogVerbosity GetGlobalLogLevel() const;
 
-	/** 获取分类树实例 */
+	/** 设置过滤模式（分类树过滤 / BqLog 原生过滤） */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	void SetFilterMode(ELEFilterMode FilterMode);
+
+	/** 获取当前过滤模式 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything")
+	ELEFilterMode GetFilterMode() const;
+
+	/** 获取分类树蓝图门面 */
 	FORCEINLINE ULECategoryTree* GetCategoryTree() const { return CategoryTree; }
 
+	/** 获取分类树核心（任意线程可持有和访问，不受 UObject 生命周期影响） */
+	FORCEINLINE TSharedPtr<FLECategoryTreeCore, ESPMode::ThreadSafe> GetCategoryTreeCore() const { return CategoryTreeCore; }
+
 	/** 检查是否已初始化 */
 	FORCEINLINE bool IsInitialized() const { return bIsInitialized; }
 
@@ -114,6 +212,11 @@ private:
 	/** 加载日志设置 */
 	bool LoadLogSettings();
 
+	/**
+	 * 生成器引导表是否与运行时 BqLog 分类一致（可跳过路径解析直接初始化分类树）
+	 */
+	bool CanBootstrapFromGeneratedTables() const;
+
 	/**
 	 * 从BqLog接口获取分类路径
 	 * @param OutCategoryPaths 输出的分类路径数组
@@ -131,14 +234,20 @@ private:
 	/** 应用分类配置 */
 	void ApplyDefaultCategoryConfigurations();
 
+	/** 应用 LogEverything.CategoryRules 控制台变量中配置的分类规则 */
+	void ApplyConfiguredCategoryRules();
+
 	/** 清理资源 */
 	void Cleanup();
 
 private:
-	/** 分类树实例 */
+	/** 分类树蓝图门面 */
 	UPROPERTY()
 	TObjectPtr<ULECategoryTree> CategoryTree;
 
+	/** 分类树核心（纯 C++，GC 不遍历） */
+	TSharedPtr<FLECategoryTreeCore, ESPMode::ThreadSafe> CategoryTreeCore;
+
 	/** 初始化状态 */
 	bool bIsInitialized;
 
@@ -45,7 +45,24 @@ enum class ELELogOutput : uint8
 	Compressed	UMETA(DisplayName = "Compressed"),
 
 	/** 输出到网络 */
-	Network		UMETA(DisplayName = "Network")
+	Network		UMETA(DisplayName = "Network"),
+
+	/** 输出到未压缩的二进制文件 */
+	Raw			UMETA(DisplayName = "Raw")
+};
+
+/**
+ * 日志过滤模式
+ * Defines which layer performs category/level filtering
+ */
+UENUM(BlueprintType)
+enum class ELEFilterMode : uint8
+{
+	/** 由 LogEverything 分类树过滤（默认） */
+	CategoryTree	UMETA(DisplayName = "Category Tree"),
+
+	/** 将分类树编译进 BqLog 的分类掩码与级别位图，由 BqLog 内联检查过滤 */
+	NativeBqLog		UMETA(DisplayName = "Native BqLog")
 };
 
 /**
@@ -80,6 +97,131 @@ struct LOGEVERYTHING_API FLECategoryLevel
 	
 };
 
+/**
+ * 缓冲区写满时的可靠性策略
+ * What happens to an entry when the BqLog ring buffer is full
+ */
+UENUM(BlueprintType)
+enum class ELELogReliability : uint8
+{
+	/** 直接丢弃，调用线程永不阻塞 */
+	Drop		UMETA(DisplayName = "Drop"),
+
+	/** 短暂等待缓冲区腾出空间（最长 BlockTimeoutMs），超时后丢弃 */
+	Block		UMETA(DisplayName = "Block"),
+
+	/** 同时写入 reliable_level=high 的独立 logger（mmap 缓冲，崩溃后可恢复），不会丢失 */
+	Guaranteed	UMETA(DisplayName = "Guaranteed")
+};
+
+/**
+ * 按日志级别配置的可靠性策略
+ * Per-level reliability / backpressure policy
+ *
+ * 主 logger 以 reliable_level=low 运行，Block 由桥接层有界重试实现，Guaranteed 额外写入高可靠 logger；
+ * 可通过 LogEverything.ReliabilityPolicy 控制台变量按部署配置，如 "Verbose=Drop,Warning=Block,Error=Guaranteed,BlockTimeoutMs=5"
+ */
+USTRUCT(BlueprintType)
+struct LOGEVERYTHING_API FLELogReliabilityPolicy
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reliability")
+	ELELogReliability Verbose = ELELogReliability::Drop;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reliability")
+	ELELogReliability Debug = ELELogReliability::Drop;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reliability")
+	ELELogReliability Info = ELELogReliability::Drop;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reliability")
+	ELELogReliability Warning = ELELogReliability::Block;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reliability")
+	ELELogReliability Error = ELELogReliability::Guaranteed;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reliability")
+	ELELogReliability Fatal = ELELogReliability::Guaranteed;
+
+	/** Block 策略的最长等待时间（毫秒） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reliability", meta = (ClampMin = "0", ClampMax = "1000"))
+	int32 BlockTimeoutMs = 5;
+
+	/** 获取级别对应的策略（NoLogging 等无效级别视为 Drop） */
+	ELELogReliability GetForLevel(ELELogVerbosity Level) const;
+
+	/** 设置级别对应的策略 */
+	void SetForLevel(ELELogVerbosity Level, ELELogReliability Reliability);
+
+	/** 是否有级别需要高可靠 logger */
+	bool RequiresGuaranteedLogger() const;
+
+	/**
+	 * 解析策略文本（以逗号、分号或空白分隔的 "级别=策略" 与 "BlockTimeoutMs=毫秒"），未提及的级别保持原值
+	 * @return 是否所有条目都有效（无效条目被跳过并输出警告）
+	 */
+	static bool Parse(FStringView PolicyText, FLELogReliabilityPolicy& InOutPolicy);
+
+	/** 转换回策略文本 */
+	FString ToString() const;
+};
+
+/**
+ * 单个分类与级别的丢失日志统计
+ * Dropped-entry count for one category and level
+ */
+USTRUCT(BlueprintType)
+struct LOGEVERYTHING_API FLEDroppedEntryStat
+{
+	GENERATED_BODY()
+
+	/** 分类完整路径 */
+	UPROPERTY(BlueprintReadOnly, Category = "Statistics")
+	FName Category;
+
+	/** 日志级别 */
+	UPROPERTY(BlueprintReadOnly, Category = "Statistics")
+	ELELogVerbosity Level = ELELogVerbosity::Info;
+
+	/** 丢失条数 */
+	UPROPERTY(BlueprintReadOnly, Category = "Statistics")
+	int64 Count = 0;
+};
+
+/**
+ * 日志路由 - 把匹配的分类与级别发往独立的 BqLog 实例
+ * Routes matching categories and levels to a dedicated BqLog logger
+ *
+ * 每条路由拥有自己的缓冲区与独立工作线程（thread_mode=independent），例如把刷屏的 Game.AI.** Verbose
+ * 与其他日志隔离，或让 Error/Fatal 不与低级别日志争用缓冲区；按顺序第一条匹配的路由生效，未匹配的留在主 logger
+ */
+USTRUCT(BlueprintType)
+struct LOGEVERYTHING_API FLELogRoute
+{
+	GENERATED_BODY()
+
+	/** 路由名称，同时作为文件名后缀（<日志文件>_<Name>） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Routing")
+	FName Name;
+
+	/** 分类模式（语法同分类规则，如 "Game.AI.**"），为空时匹配所有分类 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Routing")
+	TArray<FString> Categories;
+
+	/** 路由接收的最低级别 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Routing")
+	ELELogVerbosity MinLevel = ELELogVerbosity::Verbose;
+
+	/** 路由接收的最高级别 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Routing")
+	ELELogVerbosity MaxLevel = ELELogVerbosity::Fatal;
+
+	/** 该路由的缓冲区大小（字节） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Routing", meta = (ClampMin = "1024", ClampMax = "67108864"))
+	int32 BufferSize = 1048576;
+};
+
 /**
  * LogEverything 系统配置结构
  * Configuration structure for the LogEverything system
@@ -109,25 +251,43 @@ struct LOGEVERYTHING_API FLELogSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
 	bool bEnableAsyncLogging;
 
+	/** 异步模式下是否使用独立的工作线程（否则与其他 BqLog 实例共享公共工作线程） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (EditCondition = "bEnableAsyncLogging"))
+	bool bUseIndependentLogThread;
+
 	/** 是否启用压缩 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Storage")
 	bool bEnableCompression;
 
-	/** 日志文件路径 */
+	/** 日志文件路径：相对路径基于 Saved 目录，扩展名由 appender 类型决定，文件名后追加 _<进程ID> */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Storage")
 	FString LogFilePath;
 
-	/** 最大日志文件大小（MB） */
+	/** 最大日志文件大小（MB），超出后滚动到新文件 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Storage", meta = (ClampMin = "1", ClampMax = "1024"))
 	int32 MaxLogFileSizeMB;
 
+	/** 过滤模式 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	ELEFilterMode FilterMode;
+
+	/** 缓冲区写满时各级别的可靠性策略 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	FLELogReliabilityPolicy ReliabilityPolicy;
+
+	/** 路由表（按顺序匹配，未匹配的日志写入主 logger） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+	TArray<FLELogRoute> Routes;
+
 	FLELogSettings()
 		: GlobalLogLevel(ELELogVerbosity::Info)
 		, BufferSize(1048576) // 1MB default
 		, bEnableAsyncLogging(true)
+		, bUseIndependentLogThread(false)
 		, bEnableCompression(false)
 		, LogFilePath(TEXT("Logs/Game.log"))
 		, MaxLogFileSizeMB(100)
+		, FilterMode(ELEFilterMode::CategoryTree)
 	{
 		// 默认输出到控制台和文件
 		OutputTargets.Add(ELELogOutput::Console);
@@ -187,6 +347,54 @@ namespace LELogVerbosityUtils
 		return ELELogVerbosity::Info; // 默认级别
 	}
 
+	/** 获取级别名称（不依赖 UEnum 反射，可在任意线程调用） */
+	inline const TCHAR* ToString(ELELogVerbosity Verbosity)
+	{
+		switch (Verbosity)
+		{
+		case ELELogVerbosity::Verbose:      return TEXT("Verbose");
+		case ELELogVerbosity::Debug:        return TEXT("Debug");
+		case ELELogVerbosity::Info:         return TEXT("Info");
+		case ELELogVerbosity::Warning:      return TEXT("Warning");
+		case ELELogVerbosity::Error:        return TEXT("Error");
+		case ELELogVerbosity::Fatal:        return TEXT("Fatal");
+		case ELELogVerbosity::NoLogging:    return TEXT("NoLogging");
+		default:                            return TEXT("Unknown");
+		}
+	}
+
+	/**
+	 * 从级别名称解析（大小写不敏感），同时接受 UE 的 Log / Display / VeryVerbose 与 Off
+	 * @return 名称是否有效
+	 */
+	inline bool TryParse(FStringView Text, ELELogVerbosity& OutVerbosity)
+	{
+		static const TPair<const TCHAR*, ELELogVerbosity> Names[] =
+		{
+			{ TEXT("Verbose"), ELELogVerbosity::Verbose },
+			{ TEXT("VeryVerbose"), ELELogVerbosity::Verbose },
+			{ TEXT("Debug"), ELELogVerbosity::Debug },
+			{ TEXT("Info"), ELELogVerbosity::Info },
+			{ TEXT("Log"), ELELogVerbosity::Info },
+			{ TEXT("Display"), ELELogVerbosity::Info },
+			{ TEXT("Warning"), ELELogVerbosity::Warning },
+			{ TEXT("Error"), ELELogVerbosity::Error },
+			{ TEXT("Fatal"), ELELogVerbosity::Fatal },
+			{ TEXT("NoLogging"), ELELogVerbosity::NoLogging },
+			{ TEXT("Off"), ELELogVerbosity::NoLogging },
+		};
+
+		for (const TPair<const TCHAR*, ELELogVerbosity>& Name : Names)
+		{
+			if (Text.Equals(Name.Key, ESearchCase::IgnoreCase))
+			{
+				OutVerbosity = Name.Value;
+				return true;
+			}
+		}
+		return false;
+	}
+
 	/** 将我们的枚举转换为 BqLog 级别（零开销转换） */
 	inline uint8 ToBqLogLevel(ELELogVerbosity Verbosity)
 	{
@@ -0,0 +1,110 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UObjectArray.h"
+#include <atomic>
+
+/**
+ * 对象观察列表 - 按对象/实体 ID 放行低于分类阈值的 LE_LOG_OBJ 日志
+ * Per-object watch list backing the LE_LOG_OBJ family
+ *
+ * - ID 为 UObject 的 (序列号 << 32 | 对象索引)，或任意 uint64 实体 ID，二者共用同一个 ID 空间
+ * - 读取路径先检查观察数，再查一个无锁布隆过滤器；绝大多数"未观察"的对象在这里被拒绝，
+ *   只有布隆命中时才加锁做精确查找
+ * - 修改（添加/移除/清空）在锁内重建布隆位图，移除期间并发读取可能短暂漏掉仍被观察的对象
+ * - 进程级状态，子系统反初始化时清空（对象索引在 PIE 会话间不保持）
+ * - 原生过滤模式下，列表非空期间桥接层把 BqLog 放宽为全开、改由调用点字节表按分类阈值过滤，
+ *   否则低于阈值的观察对象日志会在 BqLog 的 is_enable_for 中被丢弃
+ */
+class LOGEVERYTHING_API FLEObjectWatchList
+{
+public:
+	/** 布隆位图的 64 位字数（4096 位） */
+	static constexpr uint32 BloomWords = 64;
+
+	/** 对象或实体是否在观察列表中 */
+	FORCEINLINE static bool IsWatched(uint64 Id)
+	{
+		if (LIKELY(NumWatched.load(std::memory_order_relaxed) == 0))
+		{
+			return false;
+		}
+
+		const uint64 Hash = HashId(Id);
+		const uint32 BitA = static_cast<uint32>(Hash) & (BloomWords * 64 - 1);
+		const uint32 BitB = static_cast<uint32>(Hash >> 32) & (BloomWords * 64 - 1);
+		if ((BloomBits[BitA >> 6].load(std::memory_order_relaxed) & (1ull << (BitA & 63))) == 0
+			|| (BloomBits[BitB >> 6].load(std::memory_order_relaxed) & (1ull << (BitB & 63))) == 0)
+		{
+			return false;
+		}
+		return ContainsExact(Id);
+	}
+
+	/** 获取 UObject 的观察 ID（对象为空时返回 0，0 永远不会被观察） */
+	FORCEINLINE static uint64 GetObjectId(const UObjectBase* Object)
+	{
+		if (!Object)
+		{
+			return 0;
+		}
+		const int32 ObjectIndex = GUObjectArray.ObjectToIndex(Object);
+		return (static_cast<uint64>(static_cast<uint32>(GUObjectArray.GetSerialNumber(ObjectIndex))) << 32) | static_cast<uint32>(ObjectIndex);
+	}
+
+	/** 实体 ID 原样使用 */
+	FORCEINLINE static uint64 GetObjectId(uint64 EntityId)
+	{
+		return EntityId;
+	}
+
+	/** 观察一个 UObject（为其分配序列号，保证 ID 在对象槽位被复用后不再匹配） */
+	static bool WatchObject(const UObjectBase* Object);
+
+	/** 取消观察一个 UObject */
+	static bool UnwatchObject(const UObjectBase* Object);
+
+	/** 观察任意实体 ID */
+	static bool WatchId(uint64 Id);
+
+	/** 取消观察实体 ID */
+	static bool UnwatchId(uint64 Id);
+
+	/** 清空观察列表 */
+	static void Clear();
+
+	/** 获取所有被观察的 ID */
+	static TArray<uint64> GetWatchedIds();
+
+	/** 被观察的 ID 数量 */
+	FORCEINLINE static int32 Num()
+	{
+		return NumWatched.load(std::memory_order_relaxed);
+	}
+
+private:
+	/** 64 位混合哈希，高低 32 位各提供一个布隆位 */
+	FORCEINLINE static uint64 HashId(uint64 Id)
+	{
+		Id ^= Id >> 33;
+		Id *= 0xff51afd7ed558ccdull;
+		Id ^= Id >> 33;
+		Id *= 0xc4ceb9fe1a85ec53ull;
+		Id ^= Id >> 33;
+		return Id;
+	}
+
+	/** 布隆命中后的精确查找（加锁，仅在命中时执行） */
+	static bool ContainsExact(uint64 Id);
+
+	/** 在锁内根据当前集合重建布隆位图 */
+	static void RebuildBloom();
+
+	/** 被观察的 ID 数量（0 时读取路径只做一次 relaxed load） */
+	static std::atomic<int32> NumWatched;
+
+	/** 布隆位图 */
+	static std::atomic<uint64> BloomBits[BloomWords];
+};
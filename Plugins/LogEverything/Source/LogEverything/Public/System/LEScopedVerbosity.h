@@ -0,0 +1,87 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "System/LELogTypes.h"
+#include "HAL/PlatformTLS.h"
+#include <atomic>
+
+/**
+ * 线程作用域级别覆盖 - 在当前线程上临时提高或降低某个分类子树的有效级别
+ * Thread-scoped verbosity override for a category subtree (RAII)
+ *
+ * 使用方式：
+ *   {
+ *       LE_SCOPED_VERBOSITY(LELogGameAI, Verbose);   // 本线程内 Game.AI.** 输出 Verbose 及以上
+ *       RunBehaviorTreeStep();
+ *   }
+ *
+ * - 覆盖只记录在线程本地的小型栈中，不修改分类树，也不使调用点缓存失效
+ * - 嵌套时内层覆盖优先；覆盖级别完全替代分类的有效级别与启用状态
+ * - 进程内没有任何活动覆盖时，调用点判断只多一次 relaxed load；
+ *   有覆盖时再读取当前线程的覆盖深度，没有覆盖的线程仍然使用调用点缓存
+ * - 编译期已剔除的级别（LE_COMPILED_MIN_VERBOSITY）无法通过覆盖恢复；
+ *   原生过滤模式下，提高级别仍受 BqLog 自身过滤的限制
+ */
+class LOGEVERYTHING_API FLEScopedVerbosity
+{
+public:
+	/** 每个线程最多同时生效的覆盖数，超出时新的覆盖被忽略并输出警告 */
+	static constexpr int32 MaxDepth = 8;
+
+	/**
+	 * 覆盖分类及其所有子分类在当前线程上的级别
+	 * @param Category 声明的分类对象 (如 LELogGameAI)
+	 * @param Level    覆盖后的最低输出级别，NoLogging 表示在本线程内静默该子树
+	 */
+	template<typename CategoryType>
+	FLEScopedVerbosity(const CategoryType& Category, ELELogVerbosity Level)
+	{
+		Push(CategoryType::CategoryIndex, Level);
+	}
+
+	~FLEScopedVerbosity();
+
+	UE_NONCOPYABLE(FLEScopedVerbosity);
+
+	/** 当前线程上是否存在活动覆盖（先检查进程内计数，避免无覆盖时的 TLS 查询） */
+	FORCEINLINE static bool AnyActive()
+	{
+		return ActiveCount.load(std::memory_order_relaxed) != 0 && FPlatformTLS::GetTlsValue(DepthTlsSlot) != nullptr;
+	}
+
+	/**
+	 * 查找当前线程对分类的覆盖级别（由内向外，命中第一个包含该分类的覆盖）
+	 * @param BqCategoryIndex BqLog 分类索引
+	 * @param OutLevel 覆盖级别
+	 * @return 当前线程是否覆盖了该分类
+	 */
+	static bool FindOverride(uint32 BqCategoryIndex, ELELogVerbosity& OutLevel);
+
+private:
+	/** 将 [BqCategoryIndex, 子树结束) 区间压入当前线程的覆盖栈 */
+	void Push(uint32 BqCategoryIndex, ELELogVerbosity Level);
+
+	/** 是否成功压栈（超出 MaxDepth 时为 false，析构时不出栈） */
+	bool bPushed = false;
+
+	/**
+	 * 保存当前线程覆盖深度的 TLS 槽位
+	 * 使用平台 TLS 而不是 thread_local：内联的 AnyActive 会展开到其他模块中，需要跨 DLL 读到同一份值
+	 */
+	static uint32 DepthTlsSlot;
+
+	/** 所有线程上活动覆盖的总数，只在压栈与出栈时修改，日志调用点只读 */
+	static std::atomic<int32> ActiveCount;
+};
+
+/**
+ * 作用域级别覆盖宏
+ * Scoped verbosity override macro
+ *
+ * @param Category   日志分类
+ * @param Verbosity  覆盖级别 (Verbose, Debug, Info, Warning, Error, Fatal, NoLogging)
+ */
+#define LE_SCOPED_VERBOSITY(Category, Verbosity) \
+	FLEScopedVerbosity PREPROCESSOR_JOIN(LE_ScopedVerbosity_, __LINE__)(Category, ELELogVerbosity::Verbosity)
@@ -0,0 +1,65 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * 基于纪元的内存回收器（RCU 读者保护）
+ * Epoch-based reclamation for read-copy-update snapshots
+ *
+ * 读者：进入读区时在自己的线程槽位中公布当前全局纪元，离开时清零，全程无锁
+ * 写者：原子替换发布指针后调用 Retire，旧对象在所有可能持有它的读者离开后才被释放
+ *
+ * 线程槽位在线程首次读取时分配、线程退出时归还；槽位耗尽时退化为共享计数，
+ * 此时回收会推迟到溢出读者全部离开之后，正确性不受影响
+ */
+class LOGEVERYTHING_API FLEEpochReclaimer
+{
+public:
+	/** 读者槽位数量 */
+	static constexpr int32 MaxReaderSlots = 256;
+
+	/** 进入读区（支持同一线程嵌套） */
+	static void EnterRead();
+
+	/** 离开读区 */
+	static void ExitRead();
+
+	/**
+	 * 退休一个已从发布指针上摘下的对象
+	 * @param Object 要回收的对象
+	 * @param Deleter 释放函数
+	 */
+	static void Retire(void* Object, void (*Deleter)(void*));
+
+	/** 类型安全的退休接口 */
+	template<typename ObjectType>
+	static void Retire(const ObjectType* Object)
+	{
+		if (Object)
+		{
+			Retire(const_cast<ObjectType*>(Object), [](void* Ptr) { delete static_cast<ObjectType*>(Ptr); });
+		}
+	}
+
+	/** 尝试释放所有已不可能被读者引用的退休对象 */
+	static void Reclaim();
+
+	/** 当前等待回收的对象数（调试用） */
+	static int32 GetNumPendingRetired();
+};
+
+/**
+ * 读区作用域
+ * RAII guard for an epoch read-side critical section
+ */
+struct FLEEpochReadScope
+{
+	FORCEINLINE FLEEpochReadScope() { FLEEpochReclaimer::EnterRead(); }
+	FORCEINLINE ~FLEEpochReadScope() { FLEEpochReclaimer::ExitRead(); }
+
+	FLEEpochReadScope(const FLEEpochReadScope&) = delete;
+	FLEEpochReadScope& operator=(const FLEEpochReadScope&) = delete;
+};
@@ -8,6 +8,8 @@
 #include "System/LELogTypes.h"
 #include "Bridge/LEBqLogBridge.h"
 #include "System/LELogSubsystem.h"
+#include "System/LELogCallSite.h"
+#include "System/LEScopedVerbosity.h"
 #include "LogEverythingUtils.generated.h"
 
 #pragma region Log
@@ -91,13 +93,13 @@ public:
 	static bool ShouldLogCategory(const UObject* WorldContext, const FName& CategoryName, ELELogVerbosity Level);
 
 	/**
-	 * 启用或禁用分类
-	 * Enable or disable log category
+	 * 启用或禁用分类（禁用由所有子分类继承）
+	 * Enable or disable log category; disabling is inherited by all descendants
 	 *
 	 * @param WorldContext 世界上下文对象
 	 * @param CategoryPath 分类路径
 	 * @param bEnabled 是否启用
-	 * @param bPropagate 是否传播到子节点
+	 * @param bPropagate 是否同时覆盖所有子分类自身的开关
 	 * @return 设置是否成功
 	 */
 	UFUNCTION(BlueprintCallable, Category = "LogEverything",
@@ -106,8 +108,8 @@ public:
 		bool bEnabled, bool bPropagate = false);
 
 	/**
-	 * 检查分类是否启用
-	 * Check if category is enabled
+	 * 检查分类是否有效启用（自身与所有祖先都启用）
+	 * Check if category is effectively enabled
 	 *
 	 * @param WorldContext 世界上下文对象
 	 * @param CategoryPath 分类路径
@@ -117,6 +119,29 @@ public:
 		meta = (DefaultToSelf = "WorldContext"))
 	static bool IsCategoryEnabled(const UObject* WorldContext, const FName& CategoryPath);
 
+	/**
+	 * 设置分类规则（按顺序求值，后者覆盖前者）
+	 * Set ordered category rules, e.g. "Game.*.Input=Warning", "**.Pathfinding=Verbose", "!Test.**"
+	 *
+	 * @param WorldContext 世界上下文对象
+	 * @param Rules 规则列表，传入空数组即清除规则
+	 * @return 是否所有规则都有效
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LogEverything",
+		meta = (DefaultToSelf = "WorldContext"))
+	static bool SetCategoryRules(const UObject* WorldContext, const TArray<FString>& Rules);
+
+	/**
+	 * 获取当前分类规则
+	 * Get current category rules
+	 *
+	 * @param WorldContext 世界上下文对象
+	 * @return 规则列表
+	 */
+	UFUNCTION(BlueprintPure, Category = "LogEverything",
+		meta = (DefaultToSelf = "WorldContext"))
+	static TArray<FString> GetCategoryRules(const UObject* WorldContext);
+
 	/**
 	 * 获取所有分类路径
 	 * Get all category paths
@@ -241,11 +266,11 @@ public:
 	static void SetEditorCategoriesLevel(const UObject* WorldContext, ELELogVerbosity Level);
 
 	/**
-	 * 内部日志实现函数 - 统一的日志处理入口
-	 * Internal logging implementation function - unified log processing entry point
+	 * 内部日志实现函数 - 通过级别判断后的日志发射入口
+	 * Internal logging implementation function - post-gate emitter
 	 *
-	 * 负责完整的日志流程：级别判断 -> 实际打印
-	 * Responsible for complete logging flow: level checking -> actual printing
+	 * 由 LE_LOG 在 ShouldLogCallSite 通过后调用，参数只在此时才被求值
+	 * Called by LE_LOG only after ShouldLogCallSite passes, so arguments are evaluated lazily
 	 *
 	 * @param Category 分类对象
 	 * @param Level 日志级别
@@ -256,6 +281,41 @@ public:
 	static void InternalLogImp(const CategoryType& Category, ELELogVerbosity Level,
 		const FormatType& Format, const Args&... Arguments);
 
+	/**
+	 * 调用点级别判断 - 纪元未变化时直接返回缓存的决策
+	 * Call-site gating - returns the cached decision while the filter epoch is unchanged
+	 */
+	FORCEINLINE static bool ShouldLogCallSite(FLELogCallSite& CallSite, uint32 CategoryIndex, ELELogVerbosity Level)
+	{
+		// 线程作用域覆盖不写入共享的调用点缓存，只在当前线程有活动覆盖时多查一次线程本地栈
+		ELELogVerbosity OverrideLevel;
+		if (UNLIKELY(FLEScopedVerbosity::AnyActive()) && FLEScopedVerbosity::FindOverride(CategoryIndex, OverrideLevel))
+		{
+			return OverrideLevel != ELELogVerbosity::NoLogging && static_cast<uint8>(Level) >= static_cast<uint8>(OverrideLevel);
+		}
+
+		const uint64 State = CallSite.PackedState.load(std::memory_order_relaxed);
+		if (LIKELY(FLELogCallSite::GetEpoch(State) == LogEverything::GCallSiteEpoch.load(std::memory_order_relaxed)))
+		{
+			return FLELogCallSite::GetDecision(State);
+		}
+		return ResolveCallSite(CallSite, CategoryIndex, Level);
+	}
+
+	/**
+	 * 重新计算调用点决策并写回缓存（慢路径，仅在纪元变化后执行）
+	 * Recompute and store the call-site decision (slow path, only after the epoch changes)
+	 */
+	static bool ResolveCallSite(FLELogCallSite& CallSite, uint32 CategoryIndex, ELELogVerbosity Level);
+
+	/**
+	 * 分类在当前线程上是否有效启用（不看级别阈值），供 LE_LOG_OBJ 放行观察对象前检查
+	 * Whether the category is effectively enabled on this thread, ignoring the level threshold
+	 *
+	 * 禁用的分类（含继承禁用与 "!" 规则）以及本线程 NoLogging 覆盖的分类返回 false
+	 */
+	static bool IsCategoryEffectivelyEnabled(uint32 CategoryIndex);
+
 public:
 	/**
 	 * 获取LogEverything子系统实例
@@ -270,32 +330,12 @@ public:
 // 前向声明
 class FLEBqLogBridge;
 
-// 模板函数实现 - 统一的日志处理入口
+// 模板函数实现 - 通过级别判断后的日志发射入口
 template<typename CategoryType, typename FormatType, typename... Args>
 void ULogEverythingUtils::InternalLogImp(const CategoryType& Category, ELELogVerbosity Level,
 	const FormatType& Format, const Args&... Arguments)
 {
-	// 第一步：通过Subsystem进行级别判断
-	ULELogSubsystem* LogSubsystem = FLEBqLogBridge::Get().GetLogSubsystem();
-	// 如果Subsystem未初始化，使用默认级别判断规则
-	if (LogSubsystem && LogSubsystem->IsInitialized())
-	{
-		// 使用Subsystem进行级别判断
-		if (!LogSubsystem->ShouldLogCategory(Category.GetCategoryName(), Level))
-		{
-			return; // 级别不匹配，直接返回，避免后续的字符串格式化
-		}
-	}
-	else
-	{
-		// 后备方案：使用默认级别判断规则
-		if (static_cast<uint8>(Level) < static_cast<uint8>(ELELogVerbosity::Info))
-		{
-			return;
-		}
-	}
-
-	// 第二步：级别判断通过，直接调用Bridge进行实际的日志打印
-	// 需要包含LEBqLogBridge.h才能调用LogWithTemplate
+	// 级别判断已由 LE_LOG 在求值参数之前完成，这里直接调用Bridge进行实际的日志打印
+	// 原生过滤模式下 BqLog 还会在内部执行 is_enable_for 检查
 	FLEBqLogBridge::Get().LogWithTemplate(Category, Level, Format, Arguments...);
-}
\ No newline at end of file
+}
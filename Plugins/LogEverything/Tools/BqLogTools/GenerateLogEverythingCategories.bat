@@ -101,6 +101,12 @@ if %ERRORLEVEL% neq 0 (
 REM Return to original directory
 popd
 
+REM Emit constexpr category tree bootstrap tables from the generated header
+python "%SCRIPT_DIR%\..\GenerateCategoryTables.py"
+if %ERRORLEVEL% neq 0 (
+    echo WARNING: Failed to generate LogEverythingCategoryTables.h, the category tree will fall back to parsing categories at startup
+)
+
 REM Verify generated files
 set "GENERATED_HEADER=%GENERATED_DIR%\LogEverythingLogger.h"
 if exist "%GENERATED_HEADER%" (
@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+# Copyright Epic Games, Inc. All Rights Reserved.
+"""
+LogEverything 分类树引导表生成器
+Post-processes BqLog_CategoryLogGenerator output into constexpr category tree tables.
+
+用法 / Usage:
+    python GenerateCategoryTables.py [--input <LogEverythingLogger.h>] [--output <LogEverythingCategoryTables.h>] [--check]
+
+从 LogEverythingLogger.h 的 names[] 数组读取 BqLog 分类名称（下标即 CAT_INDEX），生成：
+- FLECategoryNodeLinks 表：父节点 / 首子 / 末子 / 下一兄弟 / 子树结束 / 深度 / BqLog 索引
+- 完整名称、名称长度、子名称偏移
+
+BqLog 生成器按深度优先前序输出分类，因此节点索引与 BqLog 分类索引一致，
+分类树启动时直接复制这些表，无需拆分路径或逐个插入节点。
+
+传入 --check 时只比较现有输出是否最新（过期返回 1），用于构建前检查。
+"""
+
+import argparse
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+GENERATED_DIR = os.path.normpath(os.path.join(SCRIPT_DIR, "..", "Source", "Generated"))
+DEFAULT_INPUT = os.path.join(GENERATED_DIR, "LogEverythingLogger.h")
+DEFAULT_OUTPUT = os.path.join(GENERATED_DIR, "LogEverythingCategoryTables.h")
+
+NAMES_PATTERN = re.compile(r"const\s+char\s*\*\s*names\s*\[\s*(\d+)\s*\]\s*=\s*\{(.*?)\};", re.DOTALL)
+STRING_PATTERN = re.compile(r'"((?:[^"\\]|\\.)*)"')
+ROOT_NAME = "LogRoot"
+INDEX_NONE = -1
+
+
+def read_category_names(path):
+    """返回 BqLog 分类名称列表，下标即 CAT_INDEX"""
+    try:
+        with open(path, encoding="utf-8") as header_file:
+            content = header_file.read()
+    except OSError as error:
+        sys.exit(f"error: cannot read {path}: {error}")
+
+    match = NAMES_PATTERN.search(content)
+    if not match:
+        sys.exit(f"error: no category names array found in {path}")
+
+    declared_count = int(match.group(1))
+    names = STRING_PATTERN.findall(match.group(2))
+    if len(names) != declared_count:
+        sys.exit(f"error: names[{declared_count}] declares {declared_count} entries but {len(names)} were found")
+    if not names or names[0] != "":
+        sys.exit("error: category 0 must be the default (empty) category")
+    return names
+
+
+def build_links(names):
+    """计算前序布局下的结构链接，并校验 BqLog 索引顺序确实是前序"""
+    index_of = {name: index for index, name in enumerate(names)}
+    count = len(names)
+    links = [{"parent": INDEX_NONE, "first_child": INDEX_NONE, "last_child": INDEX_NONE,
+              "next_sibling": INDEX_NONE, "subtree_end": index + 1, "depth": 0} for index in range(count)]
+
+    for index in range(1, count):
+        components = names[index].split(".")
+        parent_name = ".".join(components[:-1])
+        parent = index_of.get(parent_name)
+        if parent is None:
+            sys.exit(f"error: category '{names[index]}' has no parent category '{parent_name}'")
+        if parent >= index:
+            sys.exit(f"error: category '{names[index]}' appears before its parent; BqLog output is not in pre-order")
+
+        link = links[index]
+        link["parent"] = parent
+        link["depth"] = len(components)
+
+        parent_link = links[parent]
+        if parent_link["last_child"] != INDEX_NONE:
+            links[parent_link["last_child"]]["next_sibling"] = index
+        else:
+            parent_link["first_child"] = index
+        parent_link["last_child"] = index
+
+    # 逆序回填子树区间，再校验每个子树都是连续区间
+    for index in range(count - 1, 0, -1):
+        parent = links[index]["parent"]
+        links[parent]["subtree_end"] = max(links[parent]["subtree_end"], links[index]["subtree_end"])
+    for index in range(1, count):
+        parent_link = links[links[index]["parent"]]
+        if not (links[index]["parent"] < index < parent_link["subtree_end"]):
+            sys.exit(f"error: category '{names[index]}' is outside its parent's subtree; BqLog output is not in pre-order")
+
+    return links
+
+
+def escape_tchar(text):
+    return text.replace("\\", "\\\\").replace('"', '\\"')
+
+
+def render(names, links, input_name):
+    count = len(names)
+    full_names = [ROOT_NAME] + names[1:]
+    sub_offsets = [0] + [name.rfind(".") + 1 for name in names[1:]]
+
+    lines = [
+        "// Copyright Epic Games, Inc. All Rights Reserved.",
+        "",
+        f"// 由 Tools/GenerateCategoryTables.py 根据 {input_name} 生成，请勿手动修改",
+        f"// Generated by Tools/GenerateCategoryTables.py from {input_name}. Do not edit.",
+        "",
+        "#pragma once",
+        "",
+        '#include "Category/LECategoryTreeCore.h"',
+        "",
+        "namespace LogEverythingGenerated",
+        "{",
+        f"\tinline constexpr int32 CategoryCount = {count};",
+        "",
+        "\t// ParentIndex, FirstChildIndex, LastChildIndex, NextSiblingIndex, SubtreeEnd, Depth, BqCategoryIndex",
+        "\tinline constexpr FLECategoryNodeLinks CategoryNodeLinks[CategoryCount] =",
+        "\t{",
+    ]
+    for index, link in enumerate(links):
+        lines.append(f"\t\t{{ {link['parent']}, {link['first_child']}, {link['last_child']}, {link['next_sibling']}, "
+                     f"{link['subtree_end']}, {link['depth']}, {index} }}, // {full_names[index]}")
+    lines += [
+        "\t};",
+        "",
+        "\tinline constexpr const TCHAR* CategoryFullNames[CategoryCount] =",
+        "\t{",
+    ]
+    lines += [f'\t\tTEXT("{escape_tchar(name)}"),' for name in full_names]
+    lines += [
+        "\t};",
+        "",
+        "\tinline constexpr int32 CategoryFullNameLengths[CategoryCount] =",
+        "\t{",
+        "\t\t" + ", ".join(str(len(name)) for name in full_names),
+        "\t};",
+        "",
+        "\tinline constexpr int32 CategorySubNameOffsets[CategoryCount] =",
+        "\t{",
+        "\t\t" + ", ".join(str(offset) for offset in sub_offsets),
+        "\t};",
+        "",
+        "\tinline constexpr FLECategoryTreeTables CategoryTreeTables =",
+        "\t{",
+        "\t\tCategoryCount,",
+        "\t\tCategoryNodeLinks,",
+        "\t\tCategoryFullNames,",
+        "\t\tCategoryFullNameLengths,",
+        "\t\tCategorySubNameOffsets",
+        "\t};",
+        "}",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate constexpr category tree tables from LogEverythingLogger.h.")
+    parser.add_argument("--input", default=DEFAULT_INPUT, help="BqLog generated category log header")
+    parser.add_argument("--output", default=DEFAULT_OUTPUT, help="tables header to write")
+    parser.add_argument("--check", action="store_true", help="only verify that the output is up to date")
+    args = parser.parse_args()
+
+    names = read_category_names(args.input)
+    content = render(names, build_links(names), os.path.basename(args.input))
+
+    if args.check:
+        try:
+            with open(args.output, encoding="utf-8") as existing_file:
+                up_to_date = existing_file.read() == content
+        except OSError:
+            up_to_date = False
+        print(f"{args.output}: {'up to date' if up_to_date else 'STALE'}")
+        return 0 if up_to_date else 1
+
+    with open(args.output, "w", encoding="utf-8", newline="\n") as output_file:
+        output_file.write(content)
+    print(f"Wrote {len(names)} category entries to {args.output}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
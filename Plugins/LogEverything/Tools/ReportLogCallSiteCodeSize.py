@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+# Copyright Epic Games, Inc. All Rights Reserved.
+"""
+LogEverything 调用点代码体积报告
+Reports how many bytes of code LE_LOG call sites generate in a built binary.
+
+用法 / Usage:
+    python ReportLogCallSiteCodeSize.py <binary-or-object> [...] [--baseline <binary-or-object> ...]
+                                        [--nm <nm-tool>] [--objdump <objdump-tool>] [--top N] [--csv <file>]
+
+统计依据（需要带符号的 ELF / Mach-O 目标文件或二进制，Windows 上可使用 llvm-nm 读取 clang-cl 产物）：
+- 调用点：每个 LE_LOG 展开持有一个静态 FLELogCallSite，符号名包含 LE_LogCallSite；
+  没有调用点记录的旧版本（优化前的基线）改为反汇编，按宿主函数统计对日志入口
+  （InternalLogImp / LogWithTemplate / EmitLog 实例）的调用指令，每条调用计为一个调用点
+- 宿主函数：包含调用点的函数，其代码体积反映调用点内联部分（级别判断）的开销
+- 发射函数：FLEBqLogBridge::EmitLog<...> 实例，按参数类型签名共享
+- BqLog 序列化：未被内联进发射函数的 bq::log::do_log / bq::impl 实例（理想情况下为 0）
+
+传入 --baseline 时同时统计基线并输出差值，用于验证优化前后的体积变化。
+两种统计方式的结果都会标明；入口被完全内联进宿主函数时反汇编方式无法识别，会少计调用点。
+"""
+
+import argparse
+import collections
+import csv
+import re
+import subprocess
+import sys
+
+CALL_SITE_MARKER = "LE_LogCallSite"
+EMIT_PATTERN = re.compile(r"FLEBqLogBridge::EmitLog<")
+BQ_SERIALIZATION_PATTERN = re.compile(r"bq::log::do_log<|bq::impl::_do_log_|bq::tools::make_size_seq<|bq::tools::_type_copy")
+LEGACY_EMIT_PATTERN = re.compile(r"FLEBqLogBridge::LogWithTemplate<")
+LOG_ENTRY_PATTERN = re.compile(r"ULogEverythingUtils::InternalLogImp<|FLEBqLogBridge::LogWithTemplate<|FLEBqLogBridge::EmitLog<")
+CALL_INSTRUCTION_PATTERN = re.compile(r"\s(?:call[lq]?|jmpq?|bl|b)\s")
+FUNCTION_HEADER_PATTERN = re.compile(r"^[0-9a-fA-F]+ <(.*)>:$")
+CODE_SYMBOL_TYPES = set("tTwW")
+
+
+def read_symbols(nm_tool, path):
+    """返回 [(名称, 大小, 类型)]，名称已 demangle"""
+    try:
+        output = subprocess.run(
+            [nm_tool, "-C", "-S", "--defined-only", path],
+            check=True, capture_output=True, text=True, errors="replace").stdout
+    except (OSError, subprocess.CalledProcessError) as error:
+        sys.exit(f"error: failed to run {nm_tool} on {path}: {error}")
+
+    symbols = []
+    for line in output.splitlines():
+        # 格式：<地址> <大小> <类型> <名称>，无大小的符号只有三列
+        parts = line.split(None, 3)
+        if len(parts) == 4:
+            _, size, symbol_type, name = parts
+            try:
+                symbols.append((name, int(size, 16), symbol_type))
+            except ValueError:
+                continue
+        elif len(parts) == 3:
+            _, symbol_type, name = parts
+            symbols.append((name, 0, symbol_type))
+    return symbols
+
+
+def read_log_entry_calls(objdump_tool, path):
+    """反汇编目标文件，返回 [宿主函数名]，每条对日志入口的调用指令对应一项"""
+    try:
+        output = subprocess.run(
+            [objdump_tool, "-d", "-r", "-C", "--no-show-raw-insn", path],
+            check=True, capture_output=True, text=True, errors="replace").stdout
+    except (OSError, subprocess.CalledProcessError) as error:
+        sys.exit(f"error: failed to run {objdump_tool} on {path}: {error}")
+
+    hosts = []
+    current_function = None
+    in_call = False
+    for line in output.splitlines():
+        header = FUNCTION_HEADER_PATTERN.match(line.strip())
+        if header:
+            # 日志入口之间的互相调用不是调用点
+            current_function = None if LOG_ENTRY_PATTERN.search(header.group(1)) else header.group(1)
+            in_call = False
+            continue
+        if not current_function:
+            continue
+
+        # 链接后的二进制在调用指令上标注目标；未链接的目标文件由紧随其后的重定位行给出目标
+        is_relocation = "R_" in line
+        if (CALL_INSTRUCTION_PATTERN.search(line) or (is_relocation and in_call)) and LOG_ENTRY_PATTERN.search(line):
+            hosts.append(current_function)
+            in_call = False
+        elif not is_relocation:
+            in_call = bool(CALL_INSTRUCTION_PATTERN.search(line))
+    return hosts
+
+
+def host_function_of(call_site_symbol):
+    """从 'Func(Args)::LE_LogCallSite' 得到宿主函数名"""
+    index = call_site_symbol.rfind("::" + CALL_SITE_MARKER)
+    return call_site_symbol[:index] if index > 0 else None
+
+
+def analyze(nm_tool, objdump_tool, paths):
+    code_sizes = collections.defaultdict(int)
+    call_sites = []
+    emit_bytes = emit_count = 0
+    bq_bytes = bq_count = 0
+    legacy_bytes = legacy_count = 0
+
+    for path in paths:
+        for name, size, symbol_type in read_symbols(nm_tool, path):
+            if CALL_SITE_MARKER in name and symbol_type not in CODE_SYMBOL_TYPES:
+                # 跳过守卫变量，只统计调用点记录本身
+                if "guard variable" not in name:
+                    call_sites.append(name)
+                continue
+            if symbol_type not in CODE_SYMBOL_TYPES:
+                continue
+
+            code_sizes[name] = max(code_sizes[name], size)
+            if EMIT_PATTERN.search(name):
+                emit_bytes += size
+                emit_count += 1
+            elif BQ_SERIALIZATION_PATTERN.search(name):
+                bq_bytes += size
+                bq_count += 1
+            elif LEGACY_EMIT_PATTERN.search(name):
+                legacy_bytes += size
+                legacy_count += 1
+
+    if call_sites:
+        method = "call-site records"
+        hosts = collections.Counter(filter(None, (host_function_of(site) for site in call_sites)))
+        num_call_sites = len(call_sites)
+    else:
+        # 优化前的构建没有 FLELogCallSite，改为统计对日志入口的调用
+        method = "log entry calls"
+        hosts = collections.Counter(host for path in paths for host in read_log_entry_calls(objdump_tool, path))
+        num_call_sites = sum(hosts.values())
+    host_bytes = {host: code_sizes.get(host, 0) for host in hosts}
+
+    return {
+        "method": method,
+        "call_sites": num_call_sites,
+        "hosts": hosts,
+        "host_bytes": host_bytes,
+        "host_bytes_total": sum(host_bytes.values()),
+        "emit_count": emit_count,
+        "emit_bytes": emit_bytes,
+        "bq_count": bq_count,
+        "bq_bytes": bq_bytes,
+        "legacy_count": legacy_count,
+        "legacy_bytes": legacy_bytes,
+    }
+
+
+def per_site(total, sites):
+    return total / sites if sites else 0.0
+
+
+def print_report(title, report, top):
+    sites = report["call_sites"]
+    out_of_line = report["emit_bytes"] + report["bq_bytes"] + report["legacy_bytes"]
+
+    print(f"=== {title} ===")
+    print(f"  LE_LOG call sites            : {sites} (from {report['method']})")
+    print(f"  Host functions               : {len(report['hosts'])} ({report['host_bytes_total']} bytes)")
+    print(f"  EmitLog thunks               : {report['emit_count']} ({report['emit_bytes']} bytes)")
+    print(f"  Outlined BqLog serialization : {report['bq_count']} ({report['bq_bytes']} bytes)")
+    if report["legacy_count"]:
+        print(f"  LogWithTemplate instances    : {report['legacy_count']} ({report['legacy_bytes']} bytes)")
+    print(f"  Out-of-line bytes / site     : {per_site(out_of_line, sites):.1f}")
+    print(f"  Host bytes / site            : {per_site(report['host_bytes_total'], sites):.1f}")
+
+    if top > 0 and report["hosts"]:
+        print(f"  Largest host functions (bytes, call sites):")
+        largest = sorted(report["host_bytes"].items(), key=lambda item: item[1], reverse=True)[:top]
+        for host, size in largest:
+            print(f"    {size:8d}  {report['hosts'][host]:4d}  {host}")
+
+
+def print_delta(current, baseline):
+    def delta(key):
+        return current[key] - baseline[key]
+
+    current_out = current["emit_bytes"] + current["bq_bytes"] + current["legacy_bytes"]
+    baseline_out = baseline["emit_bytes"] + baseline["bq_bytes"] + baseline["legacy_bytes"]
+
+    print("=== Delta (current - baseline) ===")
+    if current["method"] != baseline["method"]:
+        print(f"  Note: call sites counted from {current['method']} (current) and {baseline['method']} (baseline)")
+    print(f"  Call sites                   : {delta('call_sites'):+d}")
+    print(f"  Host function bytes          : {delta('host_bytes_total'):+d}")
+    print(f"  Out-of-line emission bytes   : {current_out - baseline_out:+d}")
+    print(f"  Host bytes / site            : "
+          f"{per_site(current['host_bytes_total'], current['call_sites']) - per_site(baseline['host_bytes_total'], baseline['call_sites']):+.1f}")
+
+
+def write_csv(path, report):
+    with open(path, "w", newline="") as csv_file:
+        writer = csv.writer(csv_file)
+        writer.writerow(["host_function", "call_sites", "host_bytes"])
+        for host, count in report["hosts"].most_common():
+            writer.writerow([host, count, report["host_bytes"].get(host, 0)])
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Report code size generated by LE_LOG call sites.")
+    parser.add_argument("inputs", nargs="+", help="binaries or object files to analyze")
+    parser.add_argument("--baseline", nargs="+", default=[], help="baseline binaries or object files to compare against")
+    parser.add_argument("--nm", default="nm", help="nm-compatible tool (nm, llvm-nm)")
+    parser.add_argument("--objdump", default="objdump",
+                        help="objdump-compatible tool, used for builds without call-site records (objdump, llvm-objdump)")
+    parser.add_argument("--top", type=int, default=10, help="number of largest host functions to list")
+    parser.add_argument("--csv", help="write per-host-function sizes to a CSV file")
+    args = parser.parse_args()
+
+    current = analyze(args.nm, args.objdump, args.inputs)
+    print_report("Current", current, args.top)
+
+    if args.baseline:
+        baseline = analyze(args.nm, args.objdump, args.baseline)
+        print_report("Baseline", baseline, args.top)
+        print_delta(current, baseline)
+
+    if args.csv:
+        write_csv(args.csv, current)
+
+
+if __name__ == "__main__":
+    main()